@@ -0,0 +1,254 @@
+/*
+ * Micro-benchmark for HFactor
+ *
+ * For each LP, the optimal basis is found by solving the LP. The
+ * time for INVERT of that basis is measured, as are the times and
+ * result densities of FTRAN of each column of the constraint matrix
+ * and BTRAN of each unit vector. Updates are measured by moving from
+ * the logical basis to the optimal basis one column at a time.
+ *
+ * Usage: factor_bench [-r num_repeat] [model ...]
+ *
+ * A model name without a path or extension is read from
+ * check/instances/<model>.mps
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Highs.h"
+#include "util/HFactor.h"
+#include "util/HighsTimer.h"
+
+const HighsInt kBenchUpdateLimit = 1000;
+const double kBenchPivotTolerance = 1e-7;
+const double kBenchDensityMultiplier = 0.05;
+
+struct FactorBenchRecord {
+  std::string model;
+  HighsInt num_row = 0;
+  HighsInt num_col = 0;
+  HighsInt num_build = 0;
+  double build_time = 0;
+  HighsInt num_ftran = 0;
+  double ftran_time = 0;
+  double ftran_density = 0;
+  HighsInt num_btran = 0;
+  double btran_time = 0;
+  double btran_density = 0;
+  HighsInt num_update = 0;
+  double update_time = 0;
+};
+
+// Maintain a running average of the result density, as the simplex
+// solvers do to predict the density of the next solve
+static void updateExpectedDensity(const HVector& vector,
+                                  const HighsInt num_row,
+                                  double& expected_density,
+                                  double& density_sum) {
+  const double density = (1.0 * vector.count) / num_row;
+  expected_density = (1 - kBenchDensityMultiplier) * expected_density +
+                     kBenchDensityMultiplier * density;
+  density_sum += density;
+}
+
+static std::string modelFileName(const std::string& model) {
+  if (model.find('/') != std::string::npos ||
+      model.find('.') != std::string::npos)
+    return model;
+  return std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+}
+
+static bool benchFactor(const std::string& model, const HighsInt num_repeat,
+                        FactorBenchRecord& record) {
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  if (highs.readModel(modelFileName(model)) != HighsStatus::kOk) return false;
+  // Solve without presolve so that the optimal basis is one for the
+  // LP as read
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("solver", kSimplexString);
+  if (highs.run() != HighsStatus::kOk ||
+      highs.getModelStatus() != HighsModelStatus::kOptimal)
+    return false;
+  const HighsLp& lp = highs.getLp();
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  if (num_row == 0) return false;
+  std::vector<HighsInt> optimal_basic_set(num_row);
+  highs.getBasicVariables(optimal_basic_set.data());
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    if (optimal_basic_set[iRow] < 0)
+      optimal_basic_set[iRow] = num_col - 1 - optimal_basic_set[iRow];
+  record.model = model;
+  record.num_row = num_row;
+  record.num_col = num_col;
+
+  HighsTimer timer;
+  const HighsInt build_clock = timer.clock_def("Build", "Bld");
+  const HighsInt ftran_clock = timer.clock_def("FTRAN", "Ftr");
+  const HighsInt btran_clock = timer.clock_def("BTRAN", "Btr");
+  const HighsInt update_clock = timer.clock_def("Update", "Upd");
+
+  HFactor factor;
+  std::vector<HighsInt> basic_set;
+  HVector rhs;
+  HVector col_aq;
+  HVector row_ep;
+  rhs.setup(num_row);
+  col_aq.setup(num_row);
+  row_ep.setup(num_row);
+  for (HighsInt iRepeat = 0; iRepeat < num_repeat; iRepeat++) {
+    // INVERT of the optimal basis
+    basic_set = optimal_basic_set;
+    factor.setup(lp.a_matrix_, basic_set);
+    timer.start(build_clock);
+    const HighsInt rank_deficiency = factor.build();
+    timer.stop(build_clock);
+    record.num_build++;
+    if (rank_deficiency) return false;
+
+    // FTRAN of each column of the constraint matrix
+    double expected_density = 0;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      rhs.clear();
+      rhs.packFlag = true;
+      lp.a_matrix_.collectAj(rhs, iCol, 1);
+      timer.start(ftran_clock);
+      factor.ftranCall(rhs, expected_density);
+      timer.stop(ftran_clock);
+      record.num_ftran++;
+      updateExpectedDensity(rhs, num_row, expected_density,
+                            record.ftran_density);
+    }
+
+    // BTRAN of each unit vector
+    expected_density = 0;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      rhs.clear();
+      rhs.packFlag = true;
+      rhs.count = 1;
+      rhs.index[0] = iRow;
+      rhs.array[iRow] = 1;
+      timer.start(btran_clock);
+      factor.btranCall(rhs, expected_density);
+      timer.stop(btran_clock);
+      record.num_btran++;
+      updateExpectedDensity(rhs, num_row, expected_density,
+                            record.btran_density);
+    }
+
+    // Updates that move from the logical basis towards the optimal
+    // basis, replacing the logical of largest pivot that is not in
+    // the optimal basis
+    std::vector<bool> optimal_basic(num_col + num_row, false);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      optimal_basic[optimal_basic_set[iRow]] = true;
+    basic_set.resize(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      basic_set[iRow] = num_col + iRow;
+    factor.setup(lp.a_matrix_, basic_set);
+    factor.build();
+    HighsInt num_update_since_build = 0;
+    double aq_density = 0;
+    double ep_density = 0;
+    double density_sum = 0;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      const HighsInt variable_in = optimal_basic_set[iRow];
+      if (variable_in >= num_col) continue;
+      col_aq.clear();
+      col_aq.packFlag = true;
+      lp.a_matrix_.collectAj(col_aq, variable_in, 1);
+      factor.ftranCall(col_aq, aq_density);
+      updateExpectedDensity(col_aq, num_row, aq_density, density_sum);
+      HighsInt row_out = -1;
+      double max_pivot = kBenchPivotTolerance;
+      for (HighsInt iEl = 0; iEl < col_aq.count; iEl++) {
+        const HighsInt aq_row = col_aq.index[iEl];
+        const HighsInt variable_out = basic_set[aq_row];
+        if (variable_out < num_col || optimal_basic[variable_out]) continue;
+        const double pivot = std::fabs(col_aq.array[aq_row]);
+        if (pivot > max_pivot) {
+          max_pivot = pivot;
+          row_out = aq_row;
+        }
+      }
+      if (row_out < 0) continue;
+      row_ep.clear();
+      row_ep.packFlag = true;
+      row_ep.count = 1;
+      row_ep.index[0] = row_out;
+      row_ep.array[row_out] = 1;
+      factor.btranCall(row_ep, ep_density);
+      updateExpectedDensity(row_ep, num_row, ep_density, density_sum);
+      basic_set[row_out] = variable_in;
+      HighsInt rebuild_reason = 0;
+      timer.start(update_clock);
+      factor.update(&col_aq, &row_ep, &row_out, &rebuild_reason);
+      timer.stop(update_clock);
+      record.num_update++;
+      num_update_since_build++;
+      if (rebuild_reason || num_update_since_build >= kBenchUpdateLimit) {
+        factor.build();
+        num_update_since_build = 0;
+      }
+    }
+  }
+  record.build_time = timer.read(build_clock);
+  record.ftran_time = timer.read(ftran_clock);
+  record.btran_time = timer.read(btran_clock);
+  record.update_time = timer.read(update_clock);
+  return true;
+}
+
+// Report the average time in microseconds of each operation
+static void reportFactorBench(const std::vector<FactorBenchRecord>& records) {
+  auto average = [](const double total, const HighsInt count) {
+    return count ? total / count : 0.0;
+  };
+  printf("%-12s %7s %7s | %10s | %10s %7s | %10s %7s | %10s\n", "Model",
+         "Rows", "Cols", "Build(us)", "FTRAN(us)", "Density", "BTRAN(us)",
+         "Density", "Update(us)");
+  for (const FactorBenchRecord& record : records)
+    printf("%-12s %7d %7d | %10.2f | %10.3f %7.4f | %10.3f %7.4f | %10.3f\n",
+           record.model.c_str(), (int)record.num_row, (int)record.num_col,
+           1e6 * average(record.build_time, record.num_build),
+           1e6 * average(record.ftran_time, record.num_ftran),
+           average(record.ftran_density, record.num_ftran),
+           1e6 * average(record.btran_time, record.num_btran),
+           average(record.btran_density, record.num_btran),
+           1e6 * average(record.update_time, record.num_update));
+}
+
+int main(int argc, char** argv) {
+  HighsInt num_repeat = 1;
+  std::vector<std::string> models;
+  for (int iArg = 1; iArg < argc; iArg++) {
+    if (!strcmp(argv[iArg], "-r") && iArg + 1 < argc) {
+      num_repeat = std::max(atoi(argv[++iArg]), 1);
+    } else {
+      models.push_back(argv[iArg]);
+    }
+  }
+  if (models.empty())
+    models = {"25fv47", "80bau3b", "adlittle", "afiro", "e226",
+              "etamacro", "greenbea", "israel", "scrs8", "shell",
+              "stair", "standata", "standmps"};
+  std::vector<FactorBenchRecord> records;
+  bool all_ok = true;
+  for (const std::string& model : models) {
+    FactorBenchRecord record;
+    if (benchFactor(model, num_repeat, record)) {
+      records.push_back(record);
+    } else {
+      printf("Model %s cannot be benchmarked\n", model.c_str());
+      all_ok = false;
+    }
+  }
+  reportFactorBench(records);
+  return all_ok ? 0 : 1;
+}
@@ -178,6 +178,239 @@ TEST_CASE("Factor-get-set-invert", "[highs_test_factor]") {
     REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
 }
 
+TEST_CASE("Factor-parallel-kernel", "[highs_test_factor]") {
+  // The kernel of a dense basis matrix is large enough for pivots to
+  // be eliminated in parallel, which should give an identical INVERT
+  const HighsInt dim = 200;
+  HighsSparseMatrix matrix;
+  matrix.num_col_ = dim;
+  matrix.num_row_ = dim;
+  HighsRandom random;
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      if (random.fraction() < 0.5) continue;
+      matrix.index_.push_back(iRow);
+      matrix.value_.push_back(random.fraction() - 0.5);
+    }
+    matrix.start_.push_back(matrix.index_.size());
+  }
+  std::vector<HighsInt> serial_basic_set;
+  InvertibleRepresentation serial_invert;
+  for (int num_thread = 1; num_thread <= 3; num_thread += 2) {
+    HighsTaskExecutor::ExecutorHandle handle;
+    HighsTaskExecutor::initialize(handle, num_thread);
+    HighsTaskExecutor::ScopedExecutor scoped_executor(handle);
+    std::vector<HighsInt> basic_set(dim);
+    for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set[iCol] = iCol;
+    HFactor parallel_factor;
+    parallel_factor.setup(matrix, basic_set);
+    REQUIRE(parallel_factor.build() == 0);
+    const InvertibleRepresentation invert = parallel_factor.getInvert();
+    if (num_thread == 1) {
+      serial_basic_set = basic_set;
+      serial_invert = invert;
+      continue;
+    }
+    REQUIRE(basic_set == serial_basic_set);
+    REQUIRE(invert.l_pivot_index == serial_invert.l_pivot_index);
+    REQUIRE(invert.l_start == serial_invert.l_start);
+    REQUIRE(invert.l_index == serial_invert.l_index);
+    REQUIRE(invert.l_value == serial_invert.l_value);
+    REQUIRE(invert.u_pivot_value == serial_invert.u_pivot_value);
+    REQUIRE(invert.u_start == serial_invert.u_start);
+    REQUIRE(invert.u_index == serial_invert.u_index);
+    REQUIRE(invert.u_value == serial_invert.u_value);
+  }
+}
+
+TEST_CASE("Factor-parallel-tran", "[highs_test_factor]") {
+  // The levels of the factors of a block diagonal basis matrix are
+  // wide enough for dense FTRAN and BTRAN to be performed in
+  // parallel, which should agree with the serial solves to within
+  // rounding, both after INVERT and after updates. The levels are kept
+  // when the INVERT after some updates is restored in another factor
+  const HighsInt dim = 2000;
+  const HighsInt max_block_dim = 6;
+  HighsSparseMatrix matrix;
+  matrix.num_col_ = dim;
+  matrix.num_row_ = dim;
+  HighsRandom random;
+  for (HighsInt from_row = 0; from_row < dim;) {
+    const HighsInt to_row =
+        std::min(from_row + 1 + random.integer(max_block_dim), dim);
+    for (HighsInt iCol = from_row; iCol < to_row; iCol++) {
+      for (HighsInt iRow = from_row; iRow < to_row; iRow++) {
+        matrix.index_.push_back(iRow);
+        matrix.value_.push_back(iRow == iCol ? 2 + random.fraction()
+                                             : random.fraction() - 0.5);
+      }
+      matrix.start_.push_back(matrix.index_.size());
+    }
+    from_row = to_row;
+  }
+  // Columns of a triangular matrix to enter the basis, each
+  // replacing the column of the same index
+  const HighsInt num_update = 10;
+  std::vector<HighsInt> update_row(num_update);
+  std::vector<std::vector<std::pair<HighsInt, double>>> update_column(
+      num_update);
+  for (HighsInt iUpdate = 0; iUpdate < num_update; iUpdate++) {
+    update_row[iUpdate] = (iUpdate * dim) / num_update + random.integer(50);
+    update_column[iUpdate].push_back({update_row[iUpdate], 1});
+    for (HighsInt iEl = 0; iEl < 3; iEl++)
+      update_column[iUpdate].push_back(
+          {random.integer(dim), random.fraction() - 0.5});
+  }
+  std::vector<double> tran_rhs(dim);
+  for (HighsInt iRow = 0; iRow < dim; iRow++)
+    tran_rhs[iRow] = random.fraction() - 0.5;
+
+  HighsTaskExecutor::ExecutorHandle handle;
+  HighsTaskExecutor::initialize(handle, 3);
+  HighsTaskExecutor::ScopedExecutor scoped_executor(handle);
+  std::vector<std::vector<double>> serial_solution;
+  for (HighsInt parallel_tran = 0; parallel_tran < 2; parallel_tran++) {
+    std::vector<HighsInt> basic_set(dim);
+    for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set[iCol] = iCol;
+    HFactor tran_factor;
+    tran_factor.setup(matrix, basic_set);
+    tran_factor.setParallelTran(parallel_tran);
+    REQUIRE(tran_factor.build() == 0);
+    HVector aq;
+    HVector ep;
+    HVector dense_rhs;
+    aq.setup(dim);
+    ep.setup(dim);
+    dense_rhs.setup(dim);
+    REQUIRE(tran_factor.hasParallelTranLevels() == (parallel_tran != 0));
+    const HighsInt restore_update = num_update / 2;
+    InvertibleRepresentation restore_invert;
+    std::vector<std::vector<double>> solution;
+    auto denseSolves = [&](HFactor& factor) {
+      for (HighsInt iTran = 0; iTran < 2; iTran++) {
+        dense_rhs.clear();
+        for (HighsInt iRow = 0; iRow < dim; iRow++) {
+          dense_rhs.array[iRow] = tran_rhs[iRow];
+          dense_rhs.index[iRow] = iRow;
+        }
+        dense_rhs.count = dim;
+        if (iTran == 0) {
+          factor.ftranCall(dense_rhs, 1);
+        } else {
+          factor.btranCall(dense_rhs, 1);
+        }
+        solution.push_back(dense_rhs.array);
+      }
+    };
+    for (HighsInt iUpdate = 0; iUpdate <= num_update; iUpdate++) {
+      if (iUpdate == restore_update)
+        restore_invert = tran_factor.getInvert();
+      denseSolves(tran_factor);
+      if (iUpdate == num_update) break;
+      const HighsInt row_out = update_row[iUpdate];
+      ep.clear();
+      ep.count = 1;
+      ep.index[0] = row_out;
+      ep.array[row_out] = 1;
+      ep.packFlag = true;
+      tran_factor.btranCall(ep, 1);
+      aq.clear();
+      for (auto& el : update_column[iUpdate]) {
+        if (!aq.array[el.first]) aq.index[aq.count++] = el.first;
+        aq.array[el.first] += el.second;
+      }
+      aq.packFlag = true;
+      tran_factor.ftranCall(aq, 1);
+      HighsInt rebuild_reason = 0;
+      HighsInt lc_row_out = row_out;
+      tran_factor.update(&aq, &ep, &lc_row_out, &rebuild_reason);
+      REQUIRE(rebuild_reason == 0);
+    }
+    HFactor restored_factor;
+    for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set[iCol] = iCol;
+    restored_factor.setup(matrix, basic_set);
+    restored_factor.setParallelTran(parallel_tran);
+    restored_factor.setInvert(restore_invert);
+    REQUIRE(restored_factor.hasParallelTranLevels() == (parallel_tran != 0));
+    denseSolves(restored_factor);
+    for (HighsInt iTran = 0; iTran < 2; iTran++)
+      REQUIRE(solution[2 * (num_update + 1) + iTran] ==
+              solution[2 * restore_update + iTran]);
+    if (!parallel_tran) {
+      serial_solution = solution;
+      continue;
+    }
+    REQUIRE(solution.size() == serial_solution.size());
+    for (size_t iSolve = 0; iSolve < solution.size(); iSolve++) {
+      double max_difference = 0;
+      for (HighsInt iRow = 0; iRow < dim; iRow++)
+        max_difference =
+            std::max(std::fabs(solution[iSolve][iRow] -
+                               serial_solution[iSolve][iRow]),
+                     max_difference);
+      REQUIRE(max_difference < 1e-10);
+    }
+  }
+}
+
+TEST_CASE("Factor-ftran-multi", "[highs_test_factor]") {
+  // Solving several RHS in one pass over the factors should give
+  // results identical to those of solving them individually
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  lp = highs.getLp();
+  num_col = lp.num_col_;
+  num_row = lp.num_row_;
+  std::vector<HighsInt> variable_out = {97, 151, 124, 101, 138, 130};
+  std::vector<HighsInt> variable_in = {1, 69, 76, 95, 75, 71};
+  HighsRandom random;
+  solution.resize(num_row);
+  basic_set.clear();
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    solution[iRow] = random.fraction();
+    basic_set.push_back(num_col + iRow);
+  }
+  rhs.setup(num_row);
+  col_aq.setup(num_row);
+  row_ep.setup(num_row);
+  factor.setup(lp.a_matrix_, basic_set);
+  factor.build();
+  // Perform some basis changes so that there are update etas
+  for (basis_change = 0; basis_change < (HighsInt)variable_out.size();
+       basis_change++)
+    REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
+
+  const HighsInt num_vector = 3;
+  std::vector<HVector> multi_rhs(num_vector);
+  std::vector<HVector> single_rhs(num_vector);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    multi_rhs[iVec].setup(num_row);
+  // A sparse RHS solved hyper-sparsely, a sparse RHS solved
+  // sparsely, and a dense RHS
+  const double expected_density[num_vector] = {0.01, 0.5, 1};
+  lp.a_matrix_.collectAj(multi_rhs[0], basic_set[0], 1);
+  lp.a_matrix_.collectAj(multi_rhs[1], basic_set[num_row / 2], 1);
+  for (HighsInt iCol = 0; iCol < num_row; iCol++)
+    lp.a_matrix_.collectAj(multi_rhs[2], basic_set[iCol], solution[iCol]);
+  HVector* multi_rhs_pointer[num_vector];
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    single_rhs[iVec] = multi_rhs[iVec];
+    factor.ftranCall(single_rhs[iVec], expected_density[iVec]);
+    multi_rhs_pointer[iVec] = &multi_rhs[iVec];
+  }
+  factor.ftranMulti(multi_rhs_pointer, num_vector, expected_density);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    REQUIRE(multi_rhs[iVec].count == single_rhs[iVec].count);
+    REQUIRE(multi_rhs[iVec].array == single_rhs[iVec].array);
+    multi_rhs[iVec].index.resize(multi_rhs[iVec].count);
+    single_rhs[iVec].index.resize(single_rhs[iVec].count);
+    REQUIRE(multi_rhs[iVec].index == single_rhs[iVec].index);
+  }
+}
+
 HighsInt rowOut(const HighsInt variable_out) {
   for (HighsInt iRow = 0; iRow < num_row; iRow++)
     if (basic_set[iRow] == variable_out) return iRow;
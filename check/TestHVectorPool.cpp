@@ -0,0 +1,102 @@
+#include "Highs.h"
+#include "catch.hpp"
+#include "util/HVectorPool.h"
+
+const bool dev_run = false;
+
+TEST_CASE("HVectorPool-checkout", "[util]") {
+  HVectorPool pool;
+  const HighsInt dim = 100;
+  HVector* vector0 = pool.checkout(dim);
+  REQUIRE(vector0->size == dim);
+  REQUIRE(vector0->count == 0);
+  vector0->index[vector0->count++] = 7;
+  vector0->array[7] = 1.5;
+  HVector* vector1 = pool.checkout(dim);
+  REQUIRE(vector1 != vector0);
+  REQUIRE(pool.numVector() == 2);
+  pool.checkin(vector0);
+  pool.checkin(vector1);
+  REQUIRE(pool.numFree() == 2);
+
+  // A returned vector is reused, and has been cleared
+  HVector* vector2 = pool.checkout(dim);
+  REQUIRE(pool.numVector() == 2);
+  REQUIRE(vector2->count == 0);
+  for (HighsInt iX = 0; iX < dim; iX++) REQUIRE(vector2->array[iX] == 0);
+
+  // A smaller vector uses the storage of a larger one
+  HVector* vector3 = pool.checkout(dim / 2);
+  REQUIRE(vector3->size == dim / 2);
+  REQUIRE(pool.numVector() == 2);
+  const HighsInt num_allocation = pool.numAllocation();
+
+  // A scoped vector is returned to the pool at the end of its scope
+  {
+    PooledHVector pooled_vector(dim, pool);
+    REQUIRE(pooled_vector->size == dim);
+    REQUIRE(pool.numVector() == 3);
+    REQUIRE(pool.numFree() == 0);
+  }
+  REQUIRE(pool.numFree() == 1);
+  pool.checkin(vector2);
+  pool.checkin(vector3);
+
+  // Once the pool has a vector for each that is checked out at a
+  // time, there are no more allocations
+  const HighsInt steady_num_allocation = pool.numAllocation();
+  REQUIRE(steady_num_allocation >= num_allocation);
+  for (HighsInt k = 0; k < 10; k++) {
+    HVector* vector4 = pool.checkout(dim);
+    HVector* vector5 = pool.checkout(dim / 2);
+    HVector* vector6 = pool.checkout(dim);
+    pool.checkin(vector5);
+    pool.checkin(vector4);
+    pool.checkin(vector6);
+  }
+  REQUIRE(pool.numAllocation() == steady_num_allocation);
+  REQUIRE(pool.numVector() == 3);
+
+  pool.clear();
+  REQUIRE(pool.numVector() == 0);
+  REQUIRE(pool.numFree() == 0);
+}
+
+TEST_CASE("HVectorPool-simplex", "[util]") {
+  // Re-solving an LP from scratch uses vectors from the pool of this
+  // thread, rather than allocating new ones
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  HighsRanging ranging;
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getRanging(ranging) == HighsStatus::kOk);
+  const HVectorPool& pool = HVectorPool::threadPool();
+  const HighsInt num_vector = pool.numVector();
+  const HighsInt num_allocation = pool.numAllocation();
+  REQUIRE(pool.numFree() == num_vector);
+  const HighsInt iteration_count = highs.getInfo().simplex_iteration_count;
+  for (HighsInt k = 0; k < 3; k++) {
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getInfo().simplex_iteration_count == iteration_count);
+    REQUIRE(highs.getRanging(ranging) == HighsStatus::kOk);
+  }
+  if (dev_run)
+    printf("Pool has %d vectors after %d allocations\n", (int)num_vector,
+           (int)num_allocation);
+  REQUIRE(pool.numVector() == num_vector);
+  REQUIRE(pool.numAllocation() == num_allocation);
+  REQUIRE(pool.numFree() == num_vector);
+
+  // Clearing the simplex solver for the presolved LP releases the
+  // free vectors, so solving it allocates new ones
+  highs.setOptionValue("presolve", kHighsOnString);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(pool.numAllocation() > num_allocation);
+  REQUIRE(pool.numFree() == pool.numVector());
+}
@@ -5,6 +5,7 @@
 
 #include <iostream>
 
+#include "Highs.h"
 #include "catch.hpp"
 #include "matrix_multiplication.hpp"
 #include "parallel/HighsParallel.h"
@@ -238,6 +239,262 @@ TEST_CASE("FibonacciTasksHighs", "[parallel]") {
   REQUIRE(result == 267914296);
 }
 
+TEST_CASE("FibonacciTasksHighsPinned", "[parallel]") {
+  HighsTaskExecutor::shutdown();
+  // more workers than CPUs is fine: they share the CPUs round robin
+  parallel::initialize_scheduler(4, true);
+  REQUIRE(parallel::num_threads() == 4);
+  REQUIRE(fib(30) == 1346269);
+  HighsTaskExecutor::shutdown();
+}
+
+TEST_CASE("InstanceSchedulers", "[parallel]") {
+  // Make the global scheduler's thread count differ from the instances'
+  HighsTaskExecutor::shutdown();
+  parallel::initialize_scheduler(1);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  const HighsInt num_instance = 3;
+  std::vector<HighsModelStatus> model_status(num_instance);
+  std::vector<double> objective(num_instance);
+  std::vector<std::thread> threads;
+  for (HighsInt i = 0; i < num_instance; i++)
+    threads.emplace_back([&, i]() {
+      Highs highs;
+      highs.setOptionValue("output_flag", dev_run);
+      highs.setOptionValue("instance_scheduler", true);
+      highs.setOptionValue("threads", 2);
+      highs.readModel(model_file);
+      highs.run();
+      model_status[i] = highs.getModelStatus();
+      objective[i] = highs.getInfo().objective_function_value;
+    });
+  for (auto& thread : threads) thread.join();
+  for (HighsInt i = 0; i < num_instance; i++) {
+    REQUIRE(model_status[i] == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(objective[i] - 568.1007) < 1e-4);
+  }
+
+  // An instance can change its thread count between runs, and the
+  // global scheduler is left as it was
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.setOptionValue("instance_scheduler", true) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  for (HighsInt num_thread = 2; num_thread <= 3; num_thread++) {
+    REQUIRE(highs.setOptionValue("threads", num_thread) == HighsStatus::kOk);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  }
+  REQUIRE(parallel::num_threads() == 1);
+  HighsTaskExecutor::shutdown();
+}
+
+TEST_CASE("SchedulerInfo", "[parallel]") {
+  // Counters of an executor are only changed by its own workers
+  HighsTaskExecutor::ExecutorHandle handle;
+  HighsTaskExecutor::initialize(handle, 3);
+  REQUIRE(HighsTaskExecutor::getWorkerStats(handle).size() == 3);
+  auto taskCount = [&]() {
+    int64_t count = 0;
+    for (const auto& stats : HighsTaskExecutor::getWorkerStats(handle))
+      count += stats.numTasksRun;
+    return count;
+  };
+  const int64_t initial_task_count = taskCount();
+  {
+    HighsTaskExecutor::ScopedExecutor scoped_executor(handle);
+    // Splitting 64 indices down to single ones spawns 63 tasks
+    std::vector<HighsInt> visited(64, 0);
+    parallel::for_each(
+        0, 64,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt i = start; i < end; i++) visited[i]++;
+        },
+        1);
+    REQUIRE(*std::min_element(visited.begin(), visited.end()) == 1);
+  }
+  REQUIRE(taskCount() - initial_task_count == 63);
+
+  // A solve on an instance scheduler reports the counts of that scheduler
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("instance_scheduler", true);
+  highs.setOptionValue("threads", 3);
+  // A concurrent LP solve spawns two racer tasks, which are not run if the
+  // first racer wins before they start
+  highs.setOptionValue("solver", "concurrent");
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/adlittle.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(info.scheduler_task_count <= 2);
+  REQUIRE(info.scheduler_steal_count >= 0);
+  REQUIRE(info.scheduler_failed_steal_count >= 0);
+  REQUIRE(info.scheduler_steal_time >= 0);
+  REQUIRE(info.scheduler_idle_time >= 0);
+  int64_t task_count;
+  REQUIRE(highs.getInfoValue("scheduler_task_count", task_count) ==
+          HighsStatus::kOk);
+  REQUIRE(task_count == info.scheduler_task_count);
+  // ... and is unaffected by work on other executors
+  REQUIRE(taskCount() - initial_task_count == 63);
+  HighsTaskExecutor::shutdown(handle, true);
+}
+
+TEST_CASE("ReduceAndScan", "[parallel]") {
+  const HighsInt n = 10000;
+  const HighsInt grain_size = 64;
+  std::vector<double> x(n);
+  std::vector<HighsInt> length(n);
+  for (HighsInt i = 0; i < n; i++) {
+    x[i] = (i % 7 - 3) / (i + 1.0);
+    length[i] = i % 5;
+  }
+  auto sum = [&]() {
+    return parallel::transform_reduce(
+        0, n, 0.0, [&](HighsInt i) { return x[i]; }, std::plus<double>(),
+        grain_size);
+  };
+  auto maxLength = [&]() {
+    return parallel::reduce(
+        0, n, HighsInt(0),
+        [&](HighsInt start, HighsInt end) {
+          return *std::max_element(length.begin() + start,
+                                   length.begin() + end);
+        },
+        [](HighsInt a, HighsInt b) { return std::max(a, b); }, grain_size);
+  };
+  auto scan = [&](std::vector<double>& values) {
+    return parallel::scan(values.data(), n, 1.0, std::plus<double>(),
+                          grain_size);
+  };
+
+  // Reference results from a thread that has no scheduler, so runs
+  // serially
+  double serial_sum;
+  HighsInt serial_max_length;
+  std::vector<double> serial_scan = x;
+  double serial_scan_total;
+  std::thread([&]() {
+    serial_sum = sum();
+    serial_max_length = maxLength();
+    serial_scan_total = scan(serial_scan);
+  }).join();
+  REQUIRE(serial_max_length == 4);
+  REQUIRE(std::fabs(serial_scan_total - (1.0 + serial_sum)) < 1e-12);
+
+  std::vector<HighsInt> start = length;
+  REQUIRE(parallel::scan(start.data(), n, HighsInt(0), std::plus<HighsInt>(),
+                         grain_size) == 2 * n);
+  HighsInt expected_start = 0;
+  for (HighsInt i = 0; i < n; i++) {
+    REQUIRE(start[i] == expected_start);
+    expected_start += length[i];
+  }
+
+  // The results are bitwise identical whatever the number of threads
+  for (int num_thread = 1; num_thread <= 4; num_thread++) {
+    HighsTaskExecutor::ExecutorHandle handle;
+    HighsTaskExecutor::initialize(handle, num_thread);
+    HighsTaskExecutor::ScopedExecutor scoped_executor(handle);
+    REQUIRE(sum() == serial_sum);
+    REQUIRE(maxLength() == serial_max_length);
+    std::vector<double> values = x;
+    REQUIRE(scan(values) == serial_scan_total);
+    REQUIRE(values == serial_scan);
+  }
+}
+
+TEST_CASE("StopTokens", "[parallel]") {
+  HighsStopToken unset;
+  REQUIRE(!unset.stopPossible());
+  REQUIRE(!unset.stopRequested());
+
+  HighsStopSource source;
+  HighsStopToken token = source.getToken();
+  HighsStopSource child(token);
+  HighsStopToken childToken = child.getToken();
+  REQUIRE(!childToken.stopRequested());
+  source.requestStop();
+  REQUIRE(token.stopRequested());
+  REQUIRE(childToken.stopRequested());
+  // Tokens handed out after a reset are not raised by earlier requests
+  source.reset();
+  REQUIRE(!source.getToken().stopRequested());
+
+  HighsStopSource timed;
+  timed.setTimeLimit(kHighsInf);
+  REQUIRE(!timed.stopRequested());
+  timed.setTimeLimit(0);
+  REQUIRE(timed.getToken().stopRequested());
+  REQUIRE(timed.getToken().stopReason() == HighsStopReason::kDeadline);
+  // A child inherits the reason of its parent's stop
+  HighsStopSource timedChild(timed.getToken());
+  REQUIRE(timedChild.getToken().stopReason() == HighsStopReason::kDeadline);
+  REQUIRE(childToken.stopReason() == HighsStopReason::kRequest);
+
+  parallel::initialize_scheduler(numThreads);
+  parallel::TaskGroup tg;
+  HighsStopToken taskToken = tg.getStopToken();
+  REQUIRE(!taskToken.stopRequested());
+  tg.cancel();
+  REQUIRE(taskToken.stopRequested());
+  REQUIRE(!tg.getStopToken().stopRequested());
+}
+
+TEST_CASE("StopTokenInterruptsRun", "[parallel]") {
+  HighsStopSource source;
+  source.requestStop();
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setStopToken(source.getToken());
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/adlittle.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+
+  highs.clearSolver();
+  highs.setOptionValue("solver", kIpmString);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+
+  highs.setOptionValue("solver", kHighsChooseString);
+  highs.setOptionValue("presolve", kHighsOnString);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/bell5.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+
+  // A stop due to a deadline is reported as a time limit
+  HighsStopSource timed;
+  timed.setTimeLimit(0);
+  highs.setStopToken(timed.getToken());
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/adlittle.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+  highs.clearSolver();
+  highs.setOptionValue("solver", kIpmString);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+  highs.setOptionValue("solver", kHighsChooseString);
+  highs.setOptionValue("presolve", kHighsOnString);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/bell5.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+
+  // Without a raised token the solve completes
+  highs.setStopToken(HighsStopToken());
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+}
+
 #if 0
 TEST_CASE("MatrixMultOmp", "[parallel]") {
   if (dev_run)
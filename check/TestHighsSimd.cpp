@@ -0,0 +1,162 @@
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "catch.hpp"
+#include "lp_data/HConst.h"
+#include "util/HighsRandom.h"
+#include "util/HighsSimd.h"
+
+const bool dev_run = false;
+
+// The kernels must give the same results at every instruction set
+// level, so each is compared bitwise with its scalar version on
+// random data that includes values that cancel or are tiny
+
+static bool sameBits(const std::vector<double>& v0,
+                     const std::vector<double>& v1) {
+  return v0.size() == v1.size() &&
+         std::memcmp(v0.data(), v1.data(), v0.size() * sizeof(double)) == 0;
+}
+
+static double randomValue(HighsRandom& random) {
+  switch (random.integer(5)) {
+    case 0:
+      return 0;
+    case 1:
+      return 1e-15 * (random.fraction() - 0.5);
+    case 2:
+      return 1;
+    default:
+      return 2 * random.fraction() - 1;
+  }
+}
+
+TEST_CASE("HighsSimdKernels", "[util]") {
+  const HighsSimdLevel level = highsSimdLevel();
+  if (dev_run) printf("SIMD level %d\n", (int)level);
+  HighsRandom random;
+  const HighsInt dim = 500;
+  for (HighsInt count : {0, 3, 16, 37, 250, 500}) {
+    // Distinct indices, as in an HVector or a pack of HEkkDualRow
+    std::vector<HighsInt> index(dim);
+    for (HighsInt i = 0; i < dim; i++) index[i] = i;
+    random.shuffle(index.data(), dim);
+    index.resize(count);
+
+    std::vector<double> value(dim);
+    std::vector<int8_t> move(dim);
+    for (HighsInt i = 0; i < dim; i++) {
+      value[i] = randomValue(random);
+      move[i] = random.integer(3) - 1;
+    }
+
+    // saxpy: the vector has nonzeros in some of the pivot's entries
+    // and some cancel
+    std::vector<double> array(dim, 0);
+    std::vector<HighsInt> array_index;
+    for (HighsInt i = 0; i < dim; i++) {
+      if (random.integer(2)) continue;
+      array[i] = random.integer(4) ? randomValue(random) : -value[i];
+      if (array[i]) array_index.push_back(i);
+    }
+    const HighsInt array_count = array_index.size();
+    array_index.resize(dim);
+    std::vector<double> array0 = array;
+    std::vector<HighsInt> array_index0 = array_index;
+    const HighsInt count0 = highsSimdSaxpy(
+        array_count, array_index0.data(), array0.data(), 1.0, count,
+        index.data(), value.data(), HighsSimdLevel::kNone);
+    const HighsInt count1 =
+        highsSimdSaxpy(array_count, array_index.data(), array.data(), 1.0,
+                       count, index.data(), value.data(), level);
+    REQUIRE(count0 == count1);
+    REQUIRE(array_index0 == array_index);
+    REQUIRE(sameBits(array0, array));
+
+    // Candidates for CHUZC
+    std::vector<HighsInt> position0(dim);
+    std::vector<HighsInt> position1(dim);
+    const HighsInt num_possible0 = highsSimdSelectPossible(
+        count, index.data(), value.data(), move.data(), -1.0, 1e-9,
+        position0.data(), HighsSimdLevel::kNone);
+    const HighsInt num_possible1 =
+        highsSimdSelectPossible(count, index.data(), value.data(),
+                                move.data(), -1.0, 1e-9, position1.data(),
+                                level);
+    REQUIRE(num_possible0 == num_possible1);
+    position0.resize(num_possible0);
+    position1.resize(num_possible1);
+    REQUIRE(position0 == position1);
+
+    // Dual update
+    std::vector<double> dual0(dim);
+    std::vector<double> work_value(dim);
+    std::vector<int8_t> nonbasic_flag(dim);
+    for (HighsInt i = 0; i < dim; i++) {
+      dual0[i] = randomValue(random);
+      work_value[i] = 10 * randomValue(random);
+      nonbasic_flag[i] = random.integer(2);
+    }
+    std::vector<double> dual1 = dual0;
+    const double change0 = highsSimdUpdateDual(
+        count, index.data(), value.data(), 0.3, dual0.data(),
+        work_value.data(), nonbasic_flag.data(), 0.5, HighsSimdLevel::kNone);
+    const double change1 = highsSimdUpdateDual(
+        count, index.data(), value.data(), 0.3, dual1.data(),
+        work_value.data(), nonbasic_flag.data(), 0.5, level);
+    REQUIRE(std::memcmp(&change0, &change1, sizeof(double)) == 0);
+    REQUIRE(sameBits(dual0, dual1));
+
+    // Breakpoints reached in the BFRT
+    std::vector<std::pair<HighsInt, double>> data(count);
+    for (HighsInt i = 0; i < count; i++)
+      data[i] = std::make_pair(index[i], std::fabs(value[i]));
+    std::vector<int8_t> tight0(count, -1);
+    std::vector<int8_t> tight1(count, -1);
+    const HighsInt from = count / 4;
+    highsSimdBreakpointTight(from, count, data.data(), move.data(),
+                             dual0.data(), 0.7, tight0.data(),
+                             HighsSimdLevel::kNone);
+    highsSimdBreakpointTight(from, count, data.data(), move.data(),
+                             dual0.data(), 0.7, tight1.data(), level);
+    REQUIRE(tight0 == tight1);
+  }
+}
+
+TEST_CASE("HighsSimdColumnDot", "[util]") {
+  const HighsSimdLevel level = highsSimdLevel();
+  HighsRandom random;
+  const HighsInt num_row = 300;
+  std::vector<double> x(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    x[iRow] = randomValue(random);
+  for (HighsInt num_col : {0, 3, 16, 37, 200}) {
+    // Columns of very different lengths, including empty columns, so
+    // that lanes of a block are exhausted at different entries
+    std::vector<HighsInt> start = {0};
+    std::vector<HighsInt> index;
+    std::vector<double> value;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      const HighsInt count = random.integer(6) ? random.integer(10)
+                                               : random.integer(num_row);
+      for (HighsInt iEl = 0; iEl < count; iEl++) {
+        index.push_back(random.integer(num_row));
+        value.push_back(randomValue(random));
+      }
+      start.push_back(index.size());
+    }
+    for (bool quad_precision : {false, true}) {
+      std::vector<double> dot0(num_col);
+      std::vector<double> dot1(num_col);
+      const HighsInt from_col = num_col / 5;
+      highsSimdColumnDot(from_col, num_col, start.data(), index.data(),
+                         value.data(), x.data(), quad_precision,
+                         dot0.data(), HighsSimdLevel::kNone);
+      highsSimdColumnDot(from_col, num_col, start.data(), index.data(),
+                         value.data(), x.data(), quad_precision,
+                         dot1.data(), level);
+      REQUIRE(sameBits(dot0, dot1));
+    }
+  }
+}
@@ -122,3 +122,58 @@ TEST_CASE("HotStart-rgn", "[highs_test_hot_start]") {
   // Cannot use the continuous solution as a hot start now
   REQUIRE(highs.setHotStart(hot_start) == HighsStatus::kError);
 }
+
+TEST_CASE("HotStart-factor-cache", "[highs_test_hot_start]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("simplex_factor_cache_size", 2);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getFactorCacheNumHit() == 0);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+  const HighsBasis optimal_basis = highs.getBasis();
+  HighsLp lp = highs.getLp();
+
+  // Passing the model again discards the factorization, but solving
+  // from the optimal basis uses the cached factorization
+  highs.passModel(lp);
+  highs.setBasis(optimal_basis);
+  highs.run();
+  REQUIRE(highs.getFactorCacheNumHit() == 1);
+  REQUIRE(highs.getInfo().simplex_iteration_count == 0);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) <
+          double_equal_tolerance * std::max(1.0, std::fabs(optimal_objective)));
+
+  // Re-solve with modified bounds from the optimal basis, with and
+  // without the cache
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol += 10)
+    lp.col_upper_[iCol] =
+        std::min(lp.col_upper_[iCol], lp.col_lower_[iCol] + 1);
+  Highs highs_no_cache;
+  highs_no_cache.setOptionValue("output_flag", false);
+  highs_no_cache.setOptionValue("presolve", kHighsOffString);
+  highs_no_cache.passModel(lp);
+  highs_no_cache.setBasis(optimal_basis);
+  highs_no_cache.run();
+  REQUIRE(highs_no_cache.getFactorCacheNumHit() == 0);
+
+  highs.passModel(lp);
+  highs.setBasis(optimal_basis);
+  highs.run();
+  REQUIRE(highs.getFactorCacheNumHit() == 2);
+  REQUIRE(highs.getModelStatus() == highs_no_cache.getModelStatus());
+  const double objective = highs_no_cache.getInfo().objective_function_value;
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value - objective) <
+          double_equal_tolerance * std::max(1.0, std::fabs(objective)));
+
+  // Changing the matrix prevents the cache from being used
+  highs.changeCoeff(0, 0, 2 * lp.a_matrix_.value_[0] + 1);
+  highs.setBasis(optimal_basis);
+  highs.run();
+  REQUIRE(highs.getFactorCacheNumHit() == 2);
+}
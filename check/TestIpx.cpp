@@ -1,10 +1,18 @@
+#include "Highs.h"
 #include "catch.hpp"
+#include "ipm/ipx/basis.h"
 #include "ipm/ipx/ipx_status.h"
 #include "ipm/ipx/lp_solver.h"
+#include "ipm/ipx/normal_cholesky.h"
+#include "ipm/ipx/normal_matrix.h"
+#include "ipm/ipx/sparse_matrix.h"
+#include "ipm/ipx/splitted_normal_matrix.h"
+#include "ipm/ipx/utils.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsStatus.h"
 #include "parallel/HighsParallel.h"
+#include "util/HighsRandom.h"
 
 // Example for using IPX from its C++ interface. The program solves the Netlib
 // problem afiro.
@@ -80,3 +88,279 @@ TEST_CASE("test-ipx", "[highs_ipx]") {
 
   (void)(info);  // surpress unused variable.
 }
+
+TEST_CASE("test-ipx-parallel-products", "[highs_ipx]") {
+  // Products with the normal matrix, and with the splitted normal
+  // matrix of the basis preconditioner, are blocked and shared between
+  // the workers of the scheduler if there is more than one. They agree
+  // with the serial product, and do not depend on the number of
+  // threads once there is more than one
+  const Int m = 400;
+  const Int n = 3000;
+  const Int nnz_per_col = 20;
+  HighsRandom random;
+  std::vector<Int> col_start = {0};
+  std::vector<Int> row_index;
+  std::vector<double> value;
+  for (Int j = 0; j < n; j++) {
+    std::vector<bool> in_col(m, false);
+    for (Int k = 0; k < nnz_per_col; k++) {
+      const Int i = random.integer(m);
+      if (in_col[i]) continue;
+      in_col[i] = true;
+      row_index.push_back(i);
+      value.push_back(random.fraction() - 0.5);
+    }
+    std::sort(row_index.begin() + col_start.back(), row_index.end());
+    col_start.push_back(row_index.size());
+  }
+  std::vector<double> cost(n, 1.0), lower(n, 0.0), upper(n, INFINITY);
+  std::vector<double> row_rhs(m, 0.0);
+  std::vector<char> row_type(m, '=');
+  ipx::Control control;
+  ipx::Parameters parameters;
+  parameters.display = 0;
+  control.parameters(parameters);
+  ipx::Model model;
+  REQUIRE(model.Load(control, m, n, col_start.data(), row_index.data(),
+                     value.data(), row_rhs.data(), row_type.data(),
+                     cost.data(), lower.data(), upper.data()) == 0);
+  REQUIRE(model.rows() == m);
+  const ipx::SparseMatrix& AI = model.AI();
+  // Prefer structural columns in the basis, and use two sets of
+  // scaling factors, so that the splitted normal matrix is prepared
+  // again for the same basis
+  std::vector<double> colweight(n + m, 0.0);
+  for (Int j = 0; j < n; j++) colweight[j] = 1.0 + random.fraction();
+  std::vector<ipx::Vector> colscale(2, ipx::Vector(n + m));
+  for (ipx::Vector& scale : colscale)
+    for (Int j = 0; j < n + m; j++) scale[j] = 0.5 + random.fraction();
+  ipx::Vector rhs(m);
+  for (Int i = 0; i < m; i++) rhs[i] = random.fraction() - 0.5;
+
+  // AddNormalProduct scales by the square of its diagonal
+  ipx::Vector root_colweight = std::sqrt(colscale[0]);
+  ipx::Vector serial_lhs(0.0, m);
+  ipx::AddNormalProduct(AI, &root_colweight[0], rhs, serial_lhs);
+  const double serial_dot = ipx::Dot(rhs, serial_lhs);
+
+  std::vector<ipx::Vector> lhs, splitted_lhs;
+  std::vector<double> dot, splitted_dot;
+  for (HighsInt num_thread = 1; num_thread <= 4; num_thread *= 2) {
+    HighsTaskExecutor::ExecutorHandle executor_handle;
+    HighsTaskExecutor::initialize(executor_handle, num_thread);
+    {
+      HighsTaskExecutor::ScopedExecutor scoped_executor(executor_handle);
+      REQUIRE(ipx::UseParallelProducts(AI.entries()) == (num_thread > 1));
+      ipx::NormalMatrix normal_matrix(model);
+      normal_matrix.Prepare(&colscale[0][0]);
+      lhs.emplace_back(m);
+      dot.push_back(0);
+      normal_matrix.Apply(rhs, lhs.back(), &dot.back());
+
+      ipx::Basis basis(control, model);
+      ipx::Info info;
+      basis.ConstructBasisFromWeights(colweight.data(), &info);
+      REQUIRE(info.errflag == 0);
+      ipx::SplittedNormalMatrix splitted_matrix(model);
+      for (const ipx::Vector& scale : colscale) {
+        splitted_matrix.Prepare(basis, &scale[0]);
+        splitted_lhs.emplace_back(m);
+        splitted_dot.push_back(0);
+        splitted_matrix.Apply(rhs, splitted_lhs.back(), &splitted_dot.back());
+      }
+      // Preparing for the same basis gives the product of a matrix
+      // prepared from scratch
+      ipx::SplittedNormalMatrix fresh_matrix(model);
+      fresh_matrix.Prepare(basis, &colscale[1][0]);
+      ipx::Vector fresh_lhs(m);
+      fresh_matrix.Apply(rhs, fresh_lhs, nullptr);
+      for (Int i = 0; i < m; i++)
+        REQUIRE(fresh_lhs[i] == splitted_lhs.back()[i]);
+    }
+    HighsTaskExecutor::shutdown(executor_handle, true);
+  }
+  // Entries 0 and 1 of splitted_lhs and splitted_dot are from one
+  // thread, 2 and 3 from two threads, and 4 and 5 from four threads
+  for (Int i = 0; i < m; i++) {
+    for (size_t k = 0; k < lhs.size(); k++)
+      REQUIRE(std::fabs(lhs[k][i] - serial_lhs[i]) <=
+              1e-12 * (1 + std::fabs(serial_lhs[i])));
+    REQUIRE(lhs[2][i] == lhs[1][i]);
+    for (size_t k = 2; k < splitted_lhs.size(); k++)
+      REQUIRE(std::fabs(splitted_lhs[k][i] - splitted_lhs[k % 2][i]) <=
+              1e-12 * (1 + std::fabs(splitted_lhs[k % 2][i])));
+    for (size_t k = 4; k < splitted_lhs.size(); k++)
+      REQUIRE(splitted_lhs[k][i] == splitted_lhs[k - 2][i]);
+  }
+  for (size_t k = 0; k < dot.size(); k++)
+    REQUIRE(std::fabs(dot[k] - serial_dot) <=
+            1e-12 * (1 + std::fabs(serial_dot)));
+  REQUIRE(dot[2] == dot[1]);
+  for (size_t k = 4; k < splitted_dot.size(); k++)
+    REQUIRE(splitted_dot[k] == splitted_dot[k - 2]);
+}
+
+TEST_CASE("test-ipx-cholesky", "[highs_ipx]") {
+  // The Cholesky factorization of the normal matrix inverts the normal
+  // matrix, and solving with it gives the same solution as the iterative
+  // KKT solvers
+  ipx::Control control;
+  ipx::Parameters parameters;
+  parameters.display = 0;
+  control.parameters(parameters);
+  ipx::Model model;
+  REQUIRE(model.Load(control, num_constr, num_var, Ap, Ai, Ax, rhs,
+                     constr_type, obj, lb, ub) == 0);
+  const Int m = model.rows();
+  const Int n = model.cols();
+  ipx::NormalCholesky cholesky(model);
+  REQUIRE(!cholesky.Analyse(0.0));
+  REQUIRE(cholesky.Analyse(-1.0));
+  REQUIRE(cholesky.entries() >= m);
+
+  HighsRandom random;
+  ipx::Vector W(n + m);
+  for (Int j = 0; j < n + m; j++)
+    W[j] = std::pow(10.0, 4 * random.fraction() - 2);
+  cholesky.Factorize(&W[0]);
+  REQUIRE(cholesky.dropped_pivots() == 0);
+  ipx::NormalMatrix normal_matrix(model);
+  normal_matrix.Prepare(&W[0]);
+  ipx::Vector x(m), product(m), solution(m);
+  for (Int i = 0; i < m; i++) x[i] = random.fraction() - 0.5;
+  normal_matrix.Apply(x, product, nullptr);
+  cholesky.Apply(product, solution, nullptr);
+  for (Int i = 0; i < m; i++) REQUIRE(std::fabs(solution[i] - x[i]) < 1e-10);
+
+  highs::parallel::initialize_scheduler();
+  std::vector<double> objective;
+  for (Int kkt_solver = 0; kkt_solver <= 1; kkt_solver++) {
+    ipx::LpSolver lps;
+    parameters.kkt_solver = kkt_solver;
+    lps.SetParameters(parameters);
+    REQUIRE(lps.LoadModel(num_var, obj, lb, ub, num_constr, Ap, Ai, Ax, rhs,
+                          constr_type) == 0);
+    REQUIRE(lps.Solve() == IPX_STATUS_solved);
+    REQUIRE(lps.GetInfo().status_crossover == IPX_STATUS_optimal);
+    objective.push_back(lps.GetInfo().objval);
+  }
+  REQUIRE(std::fabs(objective[0] - objective[1]) <=
+          1e-9 * (1 + std::fabs(objective[0])));
+}
+
+TEST_CASE("test-ipx-cholesky-ordering", "[highs_ipx]") {
+  // On a random sparse model, where eliminations create and absorb
+  // many elements of the quotient graph, the factorization with the
+  // approximate minimum degree ordering still inverts the normal matrix
+  const Int m = 300;
+  const Int n = 600;
+  const Int nnz_per_col = 3;
+  HighsRandom random;
+  std::vector<Int> col_start = {0};
+  std::vector<Int> row_index;
+  std::vector<double> value;
+  for (Int j = 0; j < n; j++) {
+    std::vector<bool> in_col(m, false);
+    for (Int k = 0; k < nnz_per_col; k++) {
+      const Int i = random.integer(m);
+      if (in_col[i]) continue;
+      in_col[i] = true;
+      row_index.push_back(i);
+      value.push_back(random.fraction() - 0.5);
+    }
+    std::sort(row_index.begin() + col_start.back(), row_index.end());
+    col_start.push_back(row_index.size());
+  }
+  std::vector<double> cost(n, 1.0), lower(n, 0.0), upper(n, INFINITY);
+  std::vector<double> row_rhs(m, 0.0);
+  std::vector<char> row_type(m, '=');
+  ipx::Control control;
+  ipx::Parameters parameters;
+  parameters.display = 0;
+  control.parameters(parameters);
+  ipx::Model model;
+  REQUIRE(model.Load(control, m, n, col_start.data(), row_index.data(),
+                     value.data(), row_rhs.data(), row_type.data(),
+                     cost.data(), lower.data(), upper.data()) == 0);
+  REQUIRE(model.rows() == m);
+  ipx::NormalCholesky cholesky(model);
+  REQUIRE(cholesky.Analyse(-1.0));
+  REQUIRE(cholesky.entries() >= m);
+  REQUIRE(cholesky.entries() <= m * (m + 1) / 2);
+
+  ipx::Vector W(n + m);
+  for (Int j = 0; j < n + m; j++)
+    W[j] = std::pow(10.0, 2 * random.fraction() - 1);
+  cholesky.Factorize(&W[0]);
+  REQUIRE(cholesky.dropped_pivots() == 0);
+  ipx::NormalMatrix normal_matrix(model);
+  normal_matrix.Prepare(&W[0]);
+  ipx::Vector x(m), product(m), solution(m);
+  for (Int i = 0; i < m; i++) x[i] = random.fraction() - 0.5;
+  normal_matrix.Apply(x, product, nullptr);
+  cholesky.Apply(product, solution, nullptr);
+  for (Int i = 0; i < m; i++) REQUIRE(std::fabs(solution[i] - x[i]) < 1e-8);
+}
+
+TEST_CASE("test-ipx-warm-start", "[highs_ipx]") {
+  // After changing a few bounds, IPX started from the solution and
+  // basis of the previous solve takes fewer iterations than IPX from
+  // its own starting point, and finds the same optimal solution
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  const std::vector<HighsInt> change_col = {12, 500, 1001};
+  std::vector<double> objective;
+  std::vector<HighsInt> ipm_iteration_count;
+  for (HighsInt warm_start = 0; warm_start <= 1; warm_start++) {
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("solver", kIpmString);
+    highs.setOptionValue("ipx_warm_start", warm_start == 1);
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    const HighsLp& lp = highs.getLp();
+    for (HighsInt iCol : change_col)
+      highs.changeColBounds(iCol, lp.col_lower_[iCol] - 1.0,
+                            lp.col_upper_[iCol]);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    objective.push_back(highs.getInfo().objective_function_value);
+    ipm_iteration_count.push_back(highs.getInfo().ipm_iteration_count);
+    if (dev_run)
+      printf("Warm start %d: %d IPM iterations\n", (int)warm_start,
+             (int)ipm_iteration_count.back());
+  }
+  REQUIRE(std::fabs(objective[0] - objective[1]) <=
+          1e-8 * (1 + std::fabs(objective[0])));
+  REQUIRE(ipm_iteration_count[1] < ipm_iteration_count[0]);
+}
+
+TEST_CASE("test-ipx-kkt-solver-option", "[highs_ipx]") {
+  // The ipm_kkt_solver option accepts "off", "choose" and "on", and
+  // IPX finds the same optimal solution with each of its KKT solvers
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  const std::vector<std::string> kkt_solver = {
+      kHighsOffString, kHighsChooseString, kHighsOnString};
+  std::vector<double> objective;
+  for (const std::string& value : kkt_solver) {
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("solver", kIpmString);
+    REQUIRE(highs.setOptionValue("ipm_kkt_solver", value) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    objective.push_back(highs.getInfo().objective_function_value);
+  }
+  for (size_t k = 1; k < objective.size(); k++)
+    REQUIRE(std::fabs(objective[k] - objective[0]) <=
+            1e-8 * (1 + std::fabs(objective[0])));
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.setOptionValue("ipm_kkt_solver", "cholesky") ==
+          HighsStatus::kError);
+}
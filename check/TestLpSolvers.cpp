@@ -419,3 +419,113 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-10);
 }
+
+TEST_CASE("LP-concurrent", "[highs_lp_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+
+  REQUIRE(highs.setOptionValue("solver", "concurrent") == HighsStatus::kOk);
+  // Solve from scratch, and then from the optimal basis
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  double objective = highs.getInfo().objective_function_value;
+  REQUIRE(std::fabs(objective - optimal_objective) <=
+          1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  objective = highs.getInfo().objective_function_value;
+  REQUIRE(std::fabs(objective - optimal_objective) <=
+          1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+
+  // Infeasible LP: x + y >= 2 and x + y <= 1 for nonnegative x and y
+  highs.clearModel();
+  REQUIRE(highs.setOptionValue("presolve", "off") == HighsStatus::kOk);
+  REQUIRE(highs.addVar(0, kHighsInf) == HighsStatus::kOk);
+  REQUIRE(highs.addVar(0, kHighsInf) == HighsStatus::kOk);
+  std::vector<HighsInt> index = {0, 1};
+  std::vector<double> value = {1, 1};
+  REQUIRE(highs.addRow(2, kHighsInf, 2, index.data(), value.data()) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.addRow(-kHighsInf, 1, 2, index.data(), value.data()) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+
+  REQUIRE(highs.setOptionValue("solver", "concurent") == HighsStatus::kError);
+}
+
+TEST_CASE("LP-parallel-price", "[highs_lp_solver]") {
+  // Parallel PRICE in serial dual simplex should not change the
+  // iterations, so the solutions should be identical
+  std::vector<std::string> model = {"adlittle", "25fv47", "scrs8"};
+  for (const std::string& model_name : model) {
+    const std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_name + ".mps";
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    highs.setOptionValue("instance_scheduler", true);
+    highs.setOptionValue("threads", 3);
+    highs.setOptionValue("presolve", "off");
+    highs.setOptionValue("simplex_strategy", kSimplexStrategyDualPlain);
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const HighsInt iteration_count = highs.getInfo().simplex_iteration_count;
+    const HighsSolution solution = highs.getSolution();
+
+    REQUIRE(highs.setOptionValue("simplex_parallel_price", true) ==
+            HighsStatus::kOk);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(highs.getInfo().simplex_iteration_count == iteration_count);
+    REQUIRE(highs.getSolution().col_value == solution.col_value);
+    REQUIRE(highs.getSolution().row_dual == solution.row_dual);
+  }
+}
+
+TEST_CASE("LP-parallel-dse-weights", "[highs_lp_solver]") {
+  // Initial DSE weights computed in parallel should be identical to
+  // those computed serially, so the solutions should be identical
+  std::vector<std::string> model = {"25fv47", "80bau3b"};
+  for (const std::string& model_name : model) {
+    const std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_name + ".mps";
+    std::vector<HighsInt> iteration_count;
+    std::vector<HighsSolution> solution;
+    for (HighsInt threads = 1; threads <= 3; threads += 2) {
+      Highs highs;
+      if (!dev_run) highs.setOptionValue("output_flag", false);
+      highs.setOptionValue("instance_scheduler", true);
+      highs.setOptionValue("threads", threads);
+      highs.setOptionValue("presolve", "off");
+      highs.setOptionValue("simplex_strategy", kSimplexStrategyDualPlain);
+      highs.setOptionValue("simplex_dual_edge_weight_strategy",
+                           kSimplexEdgeWeightStrategySteepestEdge);
+      REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      // Change the costs so that the optimal basis is far from
+      // optimal, and the initial DSE weights are computed
+      const HighsBasis basis = highs.getBasis();
+      const HighsLp& lp = highs.getLp();
+      for (HighsInt iCol = 0; iCol < lp.num_col_; iCol += 3)
+        highs.changeColCost(iCol, 2 * lp.col_cost_[iCol] + 1);
+      REQUIRE(highs.setBasis(basis) == HighsStatus::kOk);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      iteration_count.push_back(highs.getInfo().simplex_iteration_count);
+      solution.push_back(highs.getSolution());
+    }
+    REQUIRE(iteration_count[1] == iteration_count[0]);
+    REQUIRE(solution[1].col_value == solution[0].col_value);
+    REQUIRE(solution[1].row_dual == solution[0].row_dual);
+  }
+}
@@ -620,3 +620,35 @@ void rowlessMIP(Highs& highs) {
   solve(highs, "on", require_model_status, optimal_objective);
   solve(highs, "off", require_model_status, optimal_objective);
 }
+
+TEST_CASE("MIP-parallel-search", "[highs_test_mip_solver]") {
+  // The parallel LP bounding of open nodes needs more than one worker,
+  // so the instance gets its own scheduler with two threads
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("mip_parallel_search", true);
+  highs.setOptionValue("mip_rel_gap", 0.0);
+  highs.setOptionValue("instance_scheduler", true);
+  highs.setOptionValue("threads", 2);
+
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  highs.readModel(filename);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value - 8966406.49152) <
+          1e-6 * 8966406.49152);
+  if (dev_run)
+    printf("bell5: %d nodes pruned by parallel LP bounding\n",
+           (int)highs.getInfo().mip_parallel_pruned_node_count);
+  REQUIRE(highs.getInfo().mip_parallel_pruned_node_count > 0);
+
+  filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  highs.readModel(filename);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value - 568.1007) <
+          1e-6 * 568.1007);
+  if (dev_run)
+    printf("egout: %d nodes pruned by parallel LP bounding\n",
+           (int)highs.getInfo().mip_parallel_pruned_node_count);
+}
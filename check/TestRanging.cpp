@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
@@ -57,6 +59,102 @@ TEST_CASE("Ranging-max", "[highs_test_ranging]") {
   testRanging(highs);
 }
 
+static bool equalRangingRecord(const HighsRangingRecord& record0,
+                               const HighsRangingRecord& record1) {
+  return record0.value_ == record1.value_ &&
+         record0.objective_ == record1.objective_ &&
+         record0.in_var_ == record1.in_var_ &&
+         record0.ou_var_ == record1.ou_var_;
+}
+
+static bool equalRanging(const HighsRanging& ranging0,
+                         const HighsRanging& ranging1) {
+  return equalRangingRecord(ranging0.col_cost_up, ranging1.col_cost_up) &&
+         equalRangingRecord(ranging0.col_cost_dn, ranging1.col_cost_dn) &&
+         equalRangingRecord(ranging0.col_bound_up, ranging1.col_bound_up) &&
+         equalRangingRecord(ranging0.col_bound_dn, ranging1.col_bound_dn) &&
+         equalRangingRecord(ranging0.row_bound_up, ranging1.row_bound_up) &&
+         equalRangingRecord(ranging0.row_bound_dn, ranging1.row_bound_dn);
+}
+
+// Compare the ranging for the variables in a subset with the ranging
+// for all variables, allowing for the different order of operations
+// in the subset ranging
+static void checkSubsetRangingRecord(const HighsRangingRecord& subset,
+                                     const HighsRangingRecord& full,
+                                     const std::vector<bool>& in_set) {
+  const double tolerance = 1e-8;
+  for (size_t k = 0; k < in_set.size(); k++) {
+    if (!in_set[k]) {
+      REQUIRE(subset.in_var_[k] == -1);
+      REQUIRE(subset.ou_var_[k] == -1);
+      continue;
+    }
+    auto close = [&](const double v0, const double v1) {
+      return v0 == v1 || std::fabs(v0 - v1) <= tolerance * (1 + std::fabs(v1));
+    };
+    REQUIRE(close(subset.value_[k], full.value_[k]));
+    REQUIRE(close(subset.objective_[k], full.objective_[k]));
+  }
+}
+
+TEST_CASE("Ranging-subset", "[highs_test_ranging]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  highs.setOptionValue("instance_scheduler", true);
+  highs.setOptionValue("threads", 4);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  HighsRanging ranging;
+  REQUIRE(highs.getRanging(ranging) == HighsStatus::kOk);
+
+  // Ranging shared between workers is the same as serial ranging
+  highs.setOptionValue("threads", 1);
+  HighsRanging serial_ranging;
+  REQUIRE(highs.getRanging(serial_ranging) == HighsStatus::kOk);
+  REQUIRE(equalRanging(ranging, serial_ranging));
+
+  const HighsInt num_col = highs.getNumCol();
+  const HighsInt num_row = highs.getNumRow();
+  std::vector<HighsInt> col_set;
+  std::vector<HighsInt> row_set;
+  std::vector<bool> in_col_set(num_col, false);
+  std::vector<bool> in_row_set(num_row, false);
+  for (HighsInt iCol = 0; iCol < num_col; iCol += 7) {
+    col_set.push_back(iCol);
+    in_col_set[iCol] = true;
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow += 5) {
+    row_set.push_back(iRow);
+    in_row_set[iRow] = true;
+  }
+  highs.setOptionValue("threads", 4);
+  HighsRanging subset_ranging;
+  REQUIRE(highs.getRanging(subset_ranging, col_set.size(), col_set.data(),
+                           row_set.size(),
+                           row_set.data()) == HighsStatus::kOk);
+  REQUIRE(subset_ranging.valid);
+  checkSubsetRangingRecord(subset_ranging.col_cost_up, ranging.col_cost_up,
+                           in_col_set);
+  checkSubsetRangingRecord(subset_ranging.col_cost_dn, ranging.col_cost_dn,
+                           in_col_set);
+  checkSubsetRangingRecord(subset_ranging.col_bound_up, ranging.col_bound_up,
+                           in_col_set);
+  checkSubsetRangingRecord(subset_ranging.col_bound_dn, ranging.col_bound_dn,
+                           in_col_set);
+  checkSubsetRangingRecord(subset_ranging.row_bound_up, ranging.row_bound_up,
+                           in_row_set);
+  checkSubsetRangingRecord(subset_ranging.row_bound_dn, ranging.row_bound_dn,
+                           in_row_set);
+
+  // Indices out of range are rejected
+  const HighsInt bad_col = num_col;
+  REQUIRE(highs.getRanging(subset_ranging, 1, &bad_col, 0, nullptr) ==
+          HighsStatus::kError);
+}
+
 HighsStatus quietRun(Highs& highs) {
   highs.setOptionValue("output_flag", false);
   HighsStatus call_status = highs.run();
@@ -573,7 +573,8 @@ PYBIND11_MODULE(highs_bindings, m) {
       .value("kTimeLimit", HighsModelStatus::kTimeLimit)
       .value("kIterationLimit", HighsModelStatus::kIterationLimit)
       .value("kUnknown", HighsModelStatus::kUnknown)
-      .value("kSolutionLimit", HighsModelStatus::kSolutionLimit);
+      .value("kSolutionLimit", HighsModelStatus::kSolutionLimit)
+      .value("kInterrupt", HighsModelStatus::kInterrupt);
   py::enum_<HighsPresolveStatus>(m, "HighsPresolveStatus")
       .value("kNotPresolved", HighsPresolveStatus::kNotPresolved)
       .value("kNotReduced", HighsPresolveStatus::kNotReduced)
@@ -673,6 +674,8 @@ PYBIND11_MODULE(highs_bindings, m) {
                      &HighsInfo::objective_function_value)
       .def_readwrite("mip_dual_bound", &HighsInfo::mip_dual_bound)
       .def_readwrite("mip_gap", &HighsInfo::mip_gap)
+      .def_readwrite("mip_parallel_pruned_node_count",
+                     &HighsInfo::mip_parallel_pruned_node_count)
       .def_readwrite("max_integrality_violation",
                      &HighsInfo::max_integrality_violation)
       .def_readwrite("num_primal_infeasibilities",
@@ -686,7 +689,14 @@ PYBIND11_MODULE(highs_bindings, m) {
       .def_readwrite("max_dual_infeasibility",
                      &HighsInfo::max_dual_infeasibility)
       .def_readwrite("sum_dual_infeasibilities",
-                     &HighsInfo::sum_dual_infeasibilities);
+                     &HighsInfo::sum_dual_infeasibilities)
+      .def_readwrite("scheduler_task_count", &HighsInfo::scheduler_task_count)
+      .def_readwrite("scheduler_steal_count",
+                     &HighsInfo::scheduler_steal_count)
+      .def_readwrite("scheduler_failed_steal_count",
+                     &HighsInfo::scheduler_failed_steal_count)
+      .def_readwrite("scheduler_steal_time", &HighsInfo::scheduler_steal_time)
+      .def_readwrite("scheduler_idle_time", &HighsInfo::scheduler_idle_time);
   py::class_<HighsOptions>(m, "HighsOptions")
       .def(py::init<>())
       .def_readwrite("presolve", &HighsOptions::presolve)
@@ -709,6 +719,8 @@ PYBIND11_MODULE(highs_bindings, m) {
       .def_readwrite("objective_target", &HighsOptions::objective_target)
       .def_readwrite("random_seed", &HighsOptions::random_seed)
       .def_readwrite("threads", &HighsOptions::threads)
+      .def_readwrite("instance_scheduler", &HighsOptions::instance_scheduler)
+      .def_readwrite("thread_pinning", &HighsOptions::thread_pinning)
       .def_readwrite("highs_debug_level", &HighsOptions::highs_debug_level)
       .def_readwrite("highs_analysis_level",
                      &HighsOptions::highs_analysis_level)
@@ -729,7 +741,14 @@ PYBIND11_MODULE(highs_bindings, m) {
                      &HighsOptions::simplex_min_concurrency)
       .def_readwrite("simplex_max_concurrency",
                      &HighsOptions::simplex_max_concurrency)
+      .def_readwrite("simplex_parallel_price",
+                     &HighsOptions::simplex_parallel_price)
+      .def_readwrite("simplex_parallel_tran",
+                     &HighsOptions::simplex_parallel_tran)
+      .def_readwrite("simplex_factor_cache_size",
+                     &HighsOptions::simplex_factor_cache_size)
       .def_readwrite("ipm_iteration_limit", &HighsOptions::ipm_iteration_limit)
+      .def_readwrite("ipm_kkt_solver", &HighsOptions::ipm_kkt_solver)
       .def_readwrite("write_model_file", &HighsOptions::write_model_file)
       .def_readwrite("solution_file", &HighsOptions::solution_file)
       .def_readwrite("log_file", &HighsOptions::log_file)
@@ -754,6 +773,7 @@ PYBIND11_MODULE(highs_bindings, m) {
       .def_readwrite("simplex_price_strategy",
                      &HighsOptions::simplex_price_strategy)
       .def_readwrite("mip_detect_symmetry", &HighsOptions::mip_detect_symmetry)
+      .def_readwrite("mip_parallel_search", &HighsOptions::mip_parallel_search)
       .def_readwrite("mip_max_nodes", &HighsOptions::mip_max_nodes)
       .def_readwrite("mip_max_stall_nodes", &HighsOptions::mip_max_stall_nodes)
       .def_readwrite("mip_max_leaves", &HighsOptions::mip_max_leaves)
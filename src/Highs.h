@@ -20,6 +20,8 @@
 #include "lp_data/HighsRanging.h"
 #include "lp_data/HighsSolutionDebug.h"
 #include "model/HighsModel.h"
+#include "parallel/HighsStopToken.h"
+#include "parallel/HighsTaskExecutor.h"
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
 
@@ -184,6 +186,15 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Set a token through which the solve can be interrupted from
+   * another thread, in which case run() returns with model status
+   * kInterrupt
+   */
+  void setStopToken(const HighsStopToken& stop_token) {
+    stop_token_ = stop_token;
+  }
+
   /**
    * @brief Postsolve the incumbent model
    */
@@ -470,6 +481,16 @@ class Highs {
    */
   HighsStatus getRanging(HighsRanging& ranging);
 
+  /**
+   * @brief Get the ranging information for the current LP, restricted
+   * to the columns in col_set and the rows in row_set. For other
+   * columns and rows, the ranging values are zero and the entering
+   * and leaving variables are -1
+   */
+  HighsStatus getRanging(HighsRanging& ranging, const HighsInt num_set_col,
+                         const HighsInt* col_set, const HighsInt num_set_row,
+                         const HighsInt* row_set);
+
   /**
    * @brief Get the current model objective value
    */
@@ -1057,7 +1078,8 @@ class Highs {
    * parameter has value true, then the function will not return until all
    * memory is freed, which might be desirable when debugging heap memory but
    * requires the calling thread to wait for all scheduler threads to wake-up
-   * which is usually not necessary.
+   * which is usually not necessary. Schedulers owned by Highs instances
+   * through the option instance_scheduler are not affected.
    */
   static void resetGlobalScheduler(bool blocking = false);
 
@@ -1110,6 +1132,15 @@ class Highs {
    */
   HighsStatus getIterate();
 
+  /**
+   * @brief Get the number of times that INVERT has been avoided by
+   * using the factorization cache enabled by the option
+   * simplex_factor_cache_size. Advanced method
+   */
+  HighsInt getFactorCacheNumHit() const {
+    return ekk_instance_.factor_cache_num_hit_;
+  }
+
   /**
    * @brief Get the dual edge weights (steepest/devex) in the order of
    * the basic indices or nullptr when they are not available.
@@ -1259,6 +1290,12 @@ class Highs {
   HighsPresolveLog presolve_log_;
 
   HighsInt max_threads = 0;
+  // Scheduler used by this instance when instance_scheduler is true
+  HighsTaskExecutor::ExecutorHandle instance_scheduler_;
+  // Statistics of the scheduler's workers when run() was called
+  std::vector<HighsSplitDeque::WorkerStats> scheduler_stats_;
+  // Token through which the solve can be interrupted
+  HighsStopToken stop_token_;
   // This is strictly for debugging. It's used to check whether
   // returnFromRun() was called after the previous call to
   // Highs::run() and, assuming that this is always done, it checks
@@ -1268,6 +1305,10 @@ class Highs {
 
   bool written_log_header = false;
 
+  HighsStatus initializeScheduler();
+  const HighsTaskExecutor::ExecutorHandle& schedulerHandle();
+  void recordSchedulerStats();
+
   void exactResizeModel() {
     this->model_.lp_.exactResize();
     this->model_.hessian_.exactResize();
@@ -1414,7 +1455,8 @@ class Highs {
 
   HighsStatus getPrimalRayInterface(bool& has_primal_ray,
                                     double* primal_ray_value);
-  HighsStatus getRangingInterface();
+  HighsStatus getRangingInterface(
+      const std::vector<int8_t>* variable_mask = nullptr);
   bool aFormatOk(const HighsInt num_nz, const HighsInt format);
   bool qFormatOk(const HighsInt num_nz, const HighsInt format);
   void clearZeroHessian();
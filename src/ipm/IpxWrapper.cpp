@@ -15,6 +15,7 @@
 #include "ipm/IpxWrapper.h"
 
 #include <cassert>
+#include <cmath>
 
 #include "lp_data/HighsOptions.h"
 #include "lp_data/HighsSolution.h"
@@ -24,7 +25,8 @@ using std::min;
 HighsStatus solveLpIpx(HighsLpSolverObject& solver_object) {
   return solveLpIpx(solver_object.options_, solver_object.timer_, solver_object.lp_, 
                     solver_object.basis_, solver_object.solution_, 
-                    solver_object.model_status_, solver_object.highs_info_);
+                    solver_object.model_status_, solver_object.highs_info_,
+                    solver_object.race_timer_, solver_object.stop_token_);
 }
 
 HighsStatus solveLpIpx(const HighsOptions& options,
@@ -33,14 +35,18 @@ HighsStatus solveLpIpx(const HighsOptions& options,
                        HighsBasis& highs_basis,
 		       HighsSolution& highs_solution,
                        HighsModelStatus& model_status,
-                       HighsInfo& highs_info) {
+                       HighsInfo& highs_info,
+                       const HighsRaceTimer<double>* race_timer,
+                       const HighsStopToken& stop_token) {
   // Use IPX to try to solve the LP
   //
   // Can return HighsModelStatus (HighsStatus) values:
   //
   // 1. kSolveError (kError) if various unlikely solution errors occur
   //
-  // 2. kTimeLimit (kWarning) if time limit is reached
+  // 2. kTimeLimit (kWarning) if time limit or the deadline of the stop
+  // token is reached, or kInterrupt (kWarning) if a stop is requested
+  // explicitly through the stop token
   //
   // 3. kIterationLimit (kWarning) if iteration limit is reached
   //
@@ -59,6 +65,14 @@ HighsStatus solveLpIpx(const HighsOptions& options,
   // then a basis and primal+dual solution are obtained.
   //
   //
+  // A warm start uses the solution of the previous solve, which is
+  // retained (but invalidated) when the LP is modified, and the basis
+  // if it is still valid
+  const bool warm_start_basis = options.ipx_warm_start && highs_basis.valid;
+  const bool warm_start =
+      options.ipx_warm_start &&
+      (highs_basis.valid || highs_solution.dual_valid) &&
+      isSolutionRightSize(lp, highs_solution);
   // Indicate that there is no valid primal solution, dual solution or basis
   highs_basis.valid = false;
   highs_solution.value_valid = false;
@@ -133,6 +147,18 @@ HighsStatus solveLpIpx(const HighsOptions& options,
     // optimality tolerances
     parameters.start_crossover_tol = -1;
   }
+  // Determine how IPX solves the KKT systems: with the iterative
+  // solvers, with a Cholesky factorization of the normal matrix, or
+  // with the Cholesky factorization if its fill from the symbolic
+  // analysis is small enough
+  if (options.ipm_kkt_solver == kHighsOnString) {
+    parameters.kkt_solver = 1;
+  } else if (options.ipm_kkt_solver == kHighsOffString) {
+    parameters.kkt_solver = 0;
+  } else {
+    assert(options.ipm_kkt_solver == kHighsChooseString);
+    parameters.kkt_solver = -1;
+  }
 
   // Set the internal IPX parameters
   lps.SetParameters(parameters);
@@ -157,6 +183,16 @@ HighsStatus solveLpIpx(const HighsOptions& options,
     return HighsStatus::kError;
   }
 
+  if (warm_start)
+    loadIpxWarmStart(options, lp, highs_basis, highs_solution,
+                     warm_start_basis, num_col, num_row, col_lb, col_ub, rhs,
+                     constraint_type, lps);
+
+  // When racing other solvers, IPX is interrupted once one of them
+  // has finished
+  if (race_timer) lps.SetRaceTimer(race_timer, timer.readRunHighsClock());
+  lps.SetStopToken(stop_token);
+
   // Use IPX to solve the LP!
   ipx::Int solve_status = lps.Solve();
 
@@ -222,7 +258,10 @@ HighsStatus solveLpIpx(const HighsOptions& options,
       return HighsStatus::kError;
     // Can stop and reach time limit
     if (ipx_info.status_crossover == IPX_STATUS_time_limit) {
-      model_status = HighsModelStatus::kTimeLimit;
+      model_status =
+          stop_token.stopReason() == HighsStopReason::kRequest
+              ? HighsModelStatus::kInterrupt
+              : HighsModelStatus::kTimeLimit;
       return HighsStatus::kWarning;
     }
     //========
@@ -238,7 +277,10 @@ HighsStatus solveLpIpx(const HighsOptions& options,
     // Can stop with iter limit
     // Can stop with no progress
     if (ipx_info.status_ipm == IPX_STATUS_time_limit) {
-      model_status = HighsModelStatus::kTimeLimit;
+      model_status =
+          stop_token.stopReason() == HighsStopReason::kRequest
+              ? HighsModelStatus::kInterrupt
+              : HighsModelStatus::kTimeLimit;
       return HighsStatus::kWarning;
     } else if (ipx_info.status_ipm == IPX_STATUS_iter_limit) {
       model_status = HighsModelStatus::kIterationLimit;
@@ -499,6 +541,134 @@ void fillInIpxData(const HighsLp& lp, ipx::Int& num_col, ipx::Int& num_row,
   obj.insert(obj.end(), num_slack, 0);
 }
 
+void loadIpxWarmStart(const HighsOptions& options, const HighsLp& lp,
+                      const HighsBasis& highs_basis,
+                      const HighsSolution& highs_solution,
+                      const bool use_basis, const ipx::Int num_col,
+                      const ipx::Int num_row,
+                      const std::vector<double>& col_lb,
+                      const std::vector<double>& col_ub,
+                      const std::vector<double>& rhs,
+                      const std::vector<char>& constraint_type,
+                      ipx::LpSolver& lps) {
+  // Form the IPX point corresponding to the HiGHS solution, in the
+  // same way as ipxSolutionToHighsSolution forms the HiGHS solution
+  // from an IPX point. IPX minimizes, so duals are flipped according
+  // to lp.sense_
+  const HighsInt sense = (HighsInt)lp.sense_;
+  std::vector<double> x(num_col), xl(num_col), xu(num_col), zl(num_col),
+      zu(num_col), slack(num_row), y(num_row), z(num_col);
+  std::vector<ipx::Int> cbasis(num_row), vbasis(num_col);
+  for (HighsInt col = 0; col < lp.num_col_; col++) {
+    x[col] = highs_solution.col_value[col];
+    z[col] = sense * highs_solution.col_dual[col];
+    vbasis[col] =
+        use_basis && highs_basis.col_status[col] == HighsBasisStatus::kBasic
+            ? IPX_basic
+            : IPX_nonbasic;
+  }
+  HighsInt ipx_row = 0;
+  HighsInt ipx_slack = lp.num_col_;
+  for (HighsInt row = 0; row < lp.num_row_; row++) {
+    const double lower = lp.row_lower_[row];
+    const double upper = lp.row_upper_[row];
+    // Free rows are removed by IPX
+    if (lower <= -kHighsInf && upper >= kHighsInf) continue;
+    const double value = highs_solution.row_value[row];
+    const double dual = sense * highs_solution.row_dual[row];
+    const bool basic = use_basis && highs_basis.row_status[row] ==
+                                        HighsBasisStatus::kBasic;
+    y[ipx_row] = dual;
+    if ((lower > -kHighsInf && upper < kHighsInf) && (lower < upper)) {
+      // Boxed row - its value and dual are those of its slack
+      x[ipx_slack] = value;
+      z[ipx_slack] = dual;
+      vbasis[ipx_slack] = basic ? IPX_basic : IPX_nonbasic;
+      cbasis[ipx_row] = IPX_nonbasic;
+      ipx_slack++;
+    } else {
+      slack[ipx_row] = rhs[ipx_row] - value;
+      cbasis[ipx_row] = basic ? IPX_basic : IPX_nonbasic;
+    }
+    ipx_row++;
+  }
+  assert(ipx_row == num_row);
+  assert(ipx_slack == num_col);
+  // Move each complementary pair into the interior so that its
+  // product is at least ipx_warm_start_mu. Otherwise IPX makes a zero
+  // value in a pair positive by dividing by the other, which may be
+  // tiny
+  const double mu = options.ipx_warm_start_mu;
+  const double sqrt_mu = std::sqrt(mu);
+  auto shift = [&](double& primal, double& dual) {
+    if (primal * dual >= mu) return;
+    if (primal < sqrt_mu && dual < sqrt_mu) {
+      primal = sqrt_mu;
+      dual = sqrt_mu;
+    } else if (primal >= dual) {
+      dual = mu / primal;
+    } else {
+      primal = mu / dual;
+    }
+  };
+  // The slack of an inequality row and its dual must satisfy the
+  // sign conditions of IPX
+  for (HighsInt row = 0; row < num_row; row++) {
+    if (constraint_type[row] == '=') {
+      slack[row] = 0;
+    } else if (constraint_type[row] == '>') {
+      double primal = std::max(-slack[row], 0.0);
+      double dual = std::max(y[row], 0.0);
+      shift(primal, dual);
+      slack[row] = -primal;
+      y[row] = dual;
+    } else {
+      double primal = std::max(slack[row], 0.0);
+      double dual = std::max(-y[row], 0.0);
+      shift(primal, dual);
+      slack[row] = primal;
+      y[row] = -dual;
+    }
+  }
+  // Split the duals of the columns according to their bounds
+  for (HighsInt col = 0; col < num_col; col++) {
+    if (std::isfinite(col_lb[col])) {
+      xl[col] = std::max(x[col] - col_lb[col], 0.0);
+      zl[col] = std::max(z[col], 0.0);
+      shift(xl[col], zl[col]);
+    } else {
+      xl[col] = INFINITY;
+      zl[col] = 0;
+    }
+    if (std::isfinite(col_ub[col])) {
+      xu[col] = std::max(col_ub[col] - x[col], 0.0);
+      zu[col] = std::max(-z[col], 0.0);
+      shift(xu[col], zu[col]);
+    } else {
+      xu[col] = INFINITY;
+      zu[col] = 0;
+    }
+  }
+  ipx::Int errflag =
+      lps.LoadIPMStartingPoint(x.data(), xl.data(), xu.data(), slack.data(),
+                               y.data(), zl.data(), zu.data());
+  if (errflag) {
+    highsLogDev(options.log_options, HighsLogType::kInfo,
+                "IPX cannot use warm start point: flag = %d\n", (int)errflag);
+    return;
+  }
+  if (use_basis) {
+    errflag = lps.LoadIPMStartingBasis(cbasis.data(), vbasis.data());
+    if (errflag)
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "IPX cannot use warm start basis: flag = %d\n",
+                  (int)errflag);
+  }
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "IPX warm start from previous solution%s\n",
+               use_basis && !errflag ? " and basis" : "");
+}
+
 HighsStatus reportIpxSolveStatus(const HighsOptions& options,
                                  const ipx::Int solve_status,
                                  const ipx::Int error_flag) {
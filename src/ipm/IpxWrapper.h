@@ -27,7 +27,9 @@ HighsStatus solveLpIpx(HighsLpSolverObject& solver_object);
 HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        const HighsLp& lp, HighsBasis& highs_basis,
                        HighsSolution& highs_solution,
-                       HighsModelStatus& model_status, HighsInfo& highs_info);
+                       HighsModelStatus& model_status, HighsInfo& highs_info,
+                       const HighsRaceTimer<double>* race_timer = nullptr,
+                       const HighsStopToken& stop_token = HighsStopToken());
 
 void fillInIpxData(const HighsLp& lp, ipx::Int& num_col, ipx::Int& num_row,
                    std::vector<double>& obj, std::vector<double>& col_lb,
@@ -36,6 +38,17 @@ void fillInIpxData(const HighsLp& lp, ipx::Int& num_col, ipx::Int& num_row,
                    std::vector<double>& rhs,
                    std::vector<char>& constraint_type);
 
+void loadIpxWarmStart(const HighsOptions& options, const HighsLp& lp,
+                      const HighsBasis& highs_basis,
+                      const HighsSolution& highs_solution,
+                      const bool use_basis, const ipx::Int num_col,
+                      const ipx::Int num_row,
+                      const std::vector<double>& col_lb,
+                      const std::vector<double>& col_ub,
+                      const std::vector<double>& rhs,
+                      const std::vector<char>& constraint_type,
+                      ipx::LpSolver& lps);
+
 HighsStatus reportIpxSolveStatus(const HighsOptions& options,
                                  const ipx::Int solve_status,
                                  const ipx::Int error_flag);
@@ -388,6 +388,45 @@ void Basis::ConstructBasisFromWeights(const double* colscale, Info* info) {
         return;
 }
 
+void Basis::ConstructBasisFromStart(const Int* basic_status,
+                                    const double* colweights, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    assert(basic_status);
+    assert(colweights);
+
+    std::vector<int> status(n+m, NONBASIC);
+    Int num_basic = 0;
+    for (Int j = 0; j < n+m; j++) {
+        if (basic_status[j] == IPX_basic) {
+            status[j] = BASIC;
+            num_basic++;
+        }
+    }
+    if (num_basic != m) {
+        control_.Log() << " discarding starting basis\n";
+        ConstructBasisFromWeights(colweights, info);
+        return;
+    }
+    info->errflag = 0;
+    info->dependent_rows = 0;
+    info->dependent_cols = 0;
+    Int errflag = Load(status.data());
+    if (errflag == IPX_ERROR_basis_singular) {
+        // Singular columns have been replaced by slack columns.
+        control_.Debug() << " repaired singular starting basis\n";
+    } else if (errflag) {
+        info->errflag = errflag;
+        return;
+    }
+    PivotFreeVariablesIntoBasis(colweights, info);
+    if (info->errflag)
+        return;
+    PivotFixedVariablesOutOfBasis(colweights, info);
+    if (info->errflag)
+        return;
+}
+
 double Basis::MinSingularValue() const {
     const Int m = model_.rows();
     Vector v(m);
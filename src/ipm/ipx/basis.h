@@ -196,6 +196,17 @@ public:
     // @colweights: vector of length n+m with nonnegative entries
     void ConstructBasisFromWeights(const double* colweights, Info* info);
 
+    // Constructs a (nonsingular) basis as ConstructBasisFromWeights(), but
+    // starts from the columns with basic_status[j] == IPX_basic instead of
+    // the crash basis or slack basis. If the starting basis is singular, it
+    // is repaired with slack columns. If it does not have m columns, the
+    // method falls back to ConstructBasisFromWeights().
+    //
+    // @basic_status: vector of length n+m
+    // @colweights: vector of length n+m with nonnegative entries
+    void ConstructBasisFromStart(const Int* basic_status,
+                                 const double* colweights, Info* info);
+
     // Estimates the smallest singular value of the basis matrix.
     double MinSingularValue() const;
 
@@ -14,6 +14,11 @@ Int Control::InterruptCheck() const {
     if (parameters_.time_limit >= 0.0 &&
         parameters_.time_limit < timer_.Elapsed())
         return IPX_ERROR_interrupt_time;
+    if (race_timer_ &&
+        race_timer_->limitReached(race_time_offset_ + timer_.Elapsed()))
+        return IPX_ERROR_interrupt_time;
+    if (stop_token_.stopRequested())
+        return IPX_ERROR_interrupt_time;
     return 0;
 }
 
@@ -72,6 +77,16 @@ void Control::ResetTimer() {
     timer_.Reset();
 }
 
+void Control::race_timer(const HighsRaceTimer<double>* race_timer,
+                         double race_time_offset) {
+    race_timer_ = race_timer;
+    race_time_offset_ = race_time_offset;
+}
+
+void Control::stop_token(const HighsStopToken& stop_token) {
+    stop_token_ = stop_token;
+}
+
 void Control::MakeStream() {
     output_.clear();
     if (parameters_.display)
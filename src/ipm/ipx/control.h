@@ -8,6 +8,8 @@
 #include "ipm/ipx/ipx_internal.h"
 #include "ipm/ipx/multistream.h"
 #include "ipm/ipx/timer.h"
+#include "parallel/HighsRaceTimer.h"
+#include "parallel/HighsStopToken.h"
 
 namespace ipx {
 
@@ -16,11 +18,11 @@ namespace ipx {
 // (2) solver output,
 // (3) solver interruption.
 // Currently the solver is interrupted only by time limit. The interrupt
-// mechanism could also be used if we run IPX and a simplex code concurrently
-// and want to interrupt IPX when the simplex finished. For that reason a
-// Control object cannot be copied; assuming that one thread sets an interrupt
-// signal (not implemented yet), a call to control.InterruptCheck() from any
-// part of the solver must return nonzero. Hence we must only have references or
+// mechanism is also used when IPX races simplex codes concurrently: IPX is
+// interrupted once the race timer's limit has been reached. For that reason a
+// Control object cannot be copied; once another thread has set the race
+// limit, a call to control.InterruptCheck() from any part of the solver must
+// return nonzero. Hence we must only have references or
 // pointers to a single Control object in the whole of IPX.
 
 class Control {
@@ -65,6 +67,7 @@ public:
     double ipm_drop_primal() const { return parameters_.ipm_drop_primal; }
     double ipm_drop_dual() const { return parameters_.ipm_drop_dual; }
     double kkt_tol() const { return parameters_.kkt_tol; }
+    ipxint kkt_solver() const { return parameters_.kkt_solver; }
     ipxint crash_basis() const { return parameters_.crash_basis; }
     double dependency_tol() const { return parameters_.dependency_tol; }
     double volume_tol() const { return parameters_.volume_tol; }
@@ -95,6 +98,14 @@ public:
     // Resets the total runtime counter.
     void ResetTimer();
 
+    // Sets the race timer checked in InterruptCheck(). @race_time_offset is
+    // the race time at which the total runtime counter was last reset.
+    void race_timer(const HighsRaceTimer<double>* race_timer,
+                    double race_time_offset);
+
+    // Sets the stop token checked in InterruptCheck().
+    void stop_token(const HighsStopToken& stop_token);
+
 private:
     void MakeStream();           // composes output_
     Parameters parameters_;
@@ -103,6 +114,9 @@ private:
     mutable Timer interval_;     // time since last interval log
     mutable Multistream output_; // forwards to logfile and/or console
     mutable Multistream dummy_;  // discards everything
+    const HighsRaceTimer<double>* race_timer_{nullptr};
+    double race_time_offset_{0.0};
+    HighsStopToken stop_token_;
 };
 
 // Formats integer, string literal or floating point value into a string of
@@ -48,6 +48,11 @@ void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
     iterate_ = iterate;
     info_ = info;
     num_bad_iter_ = 0;
+    // When the IPM starts from a point provided by the user, then
+    // StartingPoint() has not been called to initialize the reference value
+    // for the divergence test.
+    if (best_complementarity_ == 0.0)
+        best_complementarity_ = iterate->complementarity();
 
     while (true) {
         if (iterate->term_crit_reached()) {
@@ -19,6 +19,7 @@ struct ipx_parameters ipx_default_parameters() {
     p.ipm_drop_primal = 1e-9;
     p.ipm_drop_dual = 1e-9;
     p.kkt_tol = 0.3;
+    p.kkt_solver = 0;
     p.crash_basis = 1;
     p.dependency_tol = 1e-6;
     p.volume_tol = 2.0;
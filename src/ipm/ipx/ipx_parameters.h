@@ -27,6 +27,7 @@ struct ipx_parameters {
 
     /* Linear solver */
     double kkt_tol;
+    ipxint kkt_solver;
 
     /* Basis construction in IPM */
     ipxint crash_basis;
@@ -0,0 +1,108 @@
+#include "ipm/ipx/kkt_solver_chol.h"
+#include <cassert>
+#include <cmath>
+#include "ipm/ipx/conjugate_residuals.h"
+
+namespace ipx {
+
+KKTSolverChol::KKTSolverChol(const Control& control, const Model& model) :
+    control_(control), model_(model), normal_matrix_(model), cholesky_(model) {
+    Int m = model_.rows();
+    Int n = model_.cols();
+    W_.resize(m+n);
+    resscale_.resize(m);
+}
+
+bool KKTSolverChol::Analyse(double max_fill) {
+    return cholesky_.Analyse(max_fill);
+}
+
+void KKTSolverChol::_Factorize(Iterate* pt, Info*) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    iter_ = 0;
+    factorized_ = false;
+
+    if (pt) {
+        const Vector& xl = pt->xl();
+        const Vector& xu = pt->xu();
+        const Vector& zl = pt->zl();
+        const Vector& zu = pt->zu();
+
+        // Build matrix W for AI*W*AI' with the same regularization of free
+        // variables as in KKTSolverDiag.
+        double regval = pt->mu();
+        for (Int j = 0; j < n+m; j++) {
+            assert(xl[j] > 0.0);
+            assert(xu[j] > 0.0);
+            double g = zl[j]/xl[j] + zu[j]/xu[j];
+            assert(std::isfinite(g));
+            if (g != 0.0 && g < regval)
+                regval = g;
+            W_[j] = 1.0 / g;        // infinity if g is zero
+        }
+        for (Int j = 0; j < n+m; j++) {
+            if (std::isinf(W_[j]))
+                W_[j] = 1.0 / regval;
+            assert(std::isfinite(W_[j]));
+            assert(W_[j] > 0.0);
+        }
+    } else {
+        W_ = 1.0;
+    }
+
+    // Residual scaling factors for termination test of CR method (see
+    // kkt_solver_diag.cc).
+    for (Int i = 0; i < m; i++)
+        resscale_[i] = 1.0 / std::sqrt(W_[n+i]);
+
+    normal_matrix_.Prepare(&W_[0]);
+    cholesky_.Factorize(&W_[0]);
+    control_.Debug(3)
+        << Textline("Cholesky pivots dropped:")
+        << cholesky_.dropped_pivots() << '\n';
+
+    factorized_ = true;
+}
+
+// Solves the normal equations as in KKTSolverDiag, but with the Cholesky
+// factorization as preconditioner.
+void KKTSolverChol::_Solve(const Vector& a, const Vector& b, double tol,
+                           Vector& x, Vector& y, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    assert(factorized_);
+
+    // Compose right-hand side AI*W*a-b.
+    Vector rhs = -b;
+    for (Int j = 0; j < n+m; j++)
+        ScatterColumn(AI, j, W_[j]*a[j], rhs);
+
+    // Solve normal equations.
+    y = 0.0;
+    normal_matrix_.reset_time();
+    cholesky_.reset_time();
+    ConjugateResiduals cr(control_);
+    cr.Solve(normal_matrix_, cholesky_, rhs, tol, &resscale_[0], maxiter_, y);
+    info->errflag = cr.errflag();
+    info->kktiter1 += cr.iter();
+    info->time_cr1 += cr.time();
+    info->time_cr1_AAt += normal_matrix_.time();
+    info->time_cr1_pre += cholesky_.time();
+    iter_ += cr.iter();
+
+    // Recover solution to KKT system.
+    for (Int i = 0; i < m; i++)
+        x[n+i] = b[i];
+    for (Int j = 0; j < n; j++) {
+        double aty = DotColumn(AI, j, y);
+        x[j] = W_[j] * (a[j]-aty);
+        for (Int p = AI.begin(j); p < AI.end(j); p++) {
+            Int i = AI.index(p);
+            x[n+i] -= x[j] * AI.value(p);
+        }
+    }
+}
+
+}  // namespace ipx
@@ -0,0 +1,59 @@
+#ifndef IPX_KKT_SOLVER_CHOL_H_
+#define IPX_KKT_SOLVER_CHOL_H_
+
+#include "ipm/ipx/control.h"
+#include "ipm/ipx/kkt_solver.h"
+#include "ipm/ipx/model.h"
+#include "ipm/ipx/normal_cholesky.h"
+#include "ipm/ipx/normal_matrix.h"
+
+namespace ipx {
+
+// KKTSolverChol implements a KKT solver that factorizes the normal matrix by a
+// sparse Cholesky factorization. The solution is refined by the Conjugate
+// Residuals method with the factorization as preconditioner, which usually
+// terminates after one or two iterations. Refinement continues when pivots of
+// the factorization were dropped because the normal matrix is close to
+// singular. If the (1,1) block of the KKT matrix is not positive definite,
+// regularization is applied as in KKTSolverDiag.
+//
+// Analyse() must have returned true before Factorize() is called. In the call
+// to Factorize() @iterate is allowed to be NULL, in which case the (1,1) block
+// of the KKT matrix is the identity matrix.
+
+class KKTSolverChol : public KKTSolver {
+public:
+    KKTSolverChol(const Control& control, const Model& model);
+
+    // Computes the ordering and sparsity pattern of the Cholesky factor.
+    // Returns false if @max_fill >= 0 and the factor would have more than
+    // @max_fill times the entries of AI.
+    bool Analyse(double max_fill);
+
+    // Returns the # entries in the Cholesky factor.
+    Int factor_entries() const { return cholesky_.entries(); }
+
+    Int maxiter() const { return maxiter_; }
+    void maxiter(Int new_maxiter) { maxiter_ = new_maxiter; }
+
+private:
+    void _Factorize(Iterate* iterate, Info* info) override;
+    void _Solve(const Vector& a, const Vector& b, double tol,
+                Vector& x, Vector& y, Info* info) override;
+    Int _iter() const override { return iter_; };
+
+    const Control& control_;
+    const Model& model_;
+    NormalMatrix normal_matrix_;
+    NormalCholesky cholesky_;
+
+    Vector W_;               // diagonal matrix in AI*W*AI'
+    Vector resscale_;        // residual scaling factors for CR termination test
+    bool factorized_{false}; // KKT matrix factorized?
+    Int maxiter_{-1};
+    Int iter_{0};            // # CR iterations since last Factorize()
+};
+
+}  // namespace ipx
+
+#endif  // IPX_KKT_SOLVER_CHOL_H_
@@ -47,6 +47,13 @@ Int LpSolver::LoadIPMStartingPoint(const double* x, const double* xl,
     return 0;
 }
 
+Int LpSolver::LoadIPMStartingBasis(const Int* cbasis, const Int* vbasis) {
+    Int errflag = model_.PresolveBasis(cbasis, vbasis, basic_status_start_);
+    if (errflag)
+        basic_status_start_.clear();
+    return errflag;
+}
+
 Int LpSolver::Solve() {
     if (model_.empty())
         return info_.status = IPX_STATUS_no_model;
@@ -116,7 +123,7 @@ Int LpSolver::Solve() {
     info_.time_total = control_.Elapsed();
     control_.Debug(2) << info_;
     control_.CloseLogfile();
-    if (control_.reportBasisData())
+    if (control_.reportBasisData() && basis_)
       basis_->reportBasisData();
     return info_.status;
 }
@@ -155,6 +162,15 @@ void LpSolver::SetParameters(Parameters new_parameters) {
     control_.parameters(new_parameters);
 }
 
+void LpSolver::SetRaceTimer(const HighsRaceTimer<double>* race_timer,
+                            double time_offset) {
+    control_.race_timer(race_timer, time_offset);
+}
+
+void LpSolver::SetStopToken(const HighsStopToken& stop_token) {
+    control_.stop_token(stop_token);
+}
+
 void LpSolver::ClearModel() {
     model_.clear();
     ClearSolution();
@@ -168,6 +184,7 @@ void LpSolver::ClearIPMStartingPoint() {
     y_start_.resize(0);
     zl_start_.resize(0);
     zu_start_.resize(0);
+    basic_status_start_.clear();
 }
 
 Int LpSolver::CrossoverFromStartingPoint(const double* x_start,
@@ -373,6 +390,8 @@ void LpSolver::InteriorPointSolve() {
 
 void LpSolver::RunIPM() {
     IPM ipm(control_);
+    KKTSolverChol kkt_chol(control_, model_);
+    const bool use_cholesky = AnalyseCholesky(kkt_chol);
 
     if (x_start_.size() != 0) {
         control_.Log() << " Using starting point provided by user."
@@ -384,7 +403,10 @@ void LpSolver::RunIPM() {
         ComputeStartingPoint(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
-        RunInitialIPM(ipm);
+        if (use_cholesky)
+            RunCholeskyIPM(ipm, kkt_chol);
+        else
+            RunInitialIPM(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
     }
@@ -504,8 +526,14 @@ void LpSolver::BuildStartingBasis() {
         return;
     }
     basis_.reset(new Basis(control_, model_));
-    control_.Log() << " Constructing starting basis...\n";
-    StartingBasis(iterate_.get(), basis_.get(), &info_);
+    if (basic_status_start_.empty()) {
+        control_.Log() << " Constructing starting basis...\n";
+        StartingBasis(iterate_.get(), basis_.get(), &info_);
+    } else {
+        control_.Log() << " Constructing starting basis from user basis...\n";
+        StartingBasis(iterate_.get(), basis_.get(), &info_,
+                      basic_status_start_.data());
+    }
     if (info_.errflag == IPX_ERROR_interrupt_time) {
         info_.errflag = 0;
         info_.status_ipm = IPX_STATUS_time_limit;
@@ -540,6 +568,50 @@ void LpSolver::RunMainIPM(IPM& ipm) {
     info_.time_ipm2 = timer.Elapsed();
 }
 
+bool LpSolver::AnalyseCholesky(KKTSolverChol& kkt) {
+    const Int kkt_solver = control_.kkt_solver();
+    if (kkt_solver == 0)
+        return false;
+    Timer timer;
+    const bool analysed = kkt.Analyse(kkt_solver < 0 ? kCholeskyMaxFill : -1.0);
+    info_.time_kkt_factorize += timer.Elapsed();
+    if (analysed)
+        control_.Log()
+            << " Using Cholesky factorization of normal matrix with "
+            << kkt.factor_entries() << " nonzeros\n";
+    return analysed;
+}
+
+void LpSolver::RunCholeskyIPM(IPM& ipm, KKTSolverChol& kkt) {
+    Timer timer;
+    // With an accurate factorization the CR method terminates after one or two
+    // iterations. When it needs more, the normal matrix has become too ill
+    // conditioned and the IPM switches to basis preconditioning, as it does
+    // when the KKT solver fails. The same holds for the stricter termination
+    // criterion for starting crossover, which is therefore not used here.
+    const double start_crossover_tol = iterate_->start_crossover_tol();
+    iterate_->start_crossover_tol(-1.0);
+    kkt.maxiter(kCholeskyMaxIter);
+    ipm.maxiter(control_.ipm_maxiter());
+    ipm.Driver(&kkt, iterate_.get(), &info_);
+    iterate_->start_crossover_tol(start_crossover_tol);
+    switch (info_.status_ipm) {
+    case IPX_STATUS_optimal:
+        // Without crossover no basis is needed, so the solve is complete.
+        if (control_.run_crossover())
+            info_.status_ipm = IPX_STATUS_not_run;
+        break;
+    case IPX_STATUS_no_progress:
+        info_.status_ipm = IPX_STATUS_not_run;
+        break;
+    case IPX_STATUS_failed:
+        info_.status_ipm = IPX_STATUS_not_run;
+        info_.errflag = 0;
+        break;
+    }
+    info_.time_ipm1 += timer.Elapsed();
+}
+
 void LpSolver::BuildCrossoverStartingPoint() {
     const Int m = model_.rows();
     const Int n = model_.cols();
@@ -6,6 +6,7 @@
 #include "ipm/ipx/control.h"
 #include "ipm/ipx/ipm.h"
 #include "ipm/ipx/iterate.h"
+#include "ipm/ipx/kkt_solver_chol.h"
 #include "ipm/ipx/model.h"
 
 namespace ipx {
@@ -66,6 +67,22 @@ public:
                              const double* y, const double* zl,
                              const double* zu);
 
+    // Loads a basis from which the IPM builds its starting basis, instead of
+    // crashing one from the starting point. The basis is used in the next
+    // call to Solve() once the IPM switches to basis preconditioning, so that
+    // crossover starts from a basis that evolved from it. Its intended use is
+    // together with LoadIPMStartingPoint() for re-solving a modified model.
+    // @cbasis: size num_constr array
+    // @vbasis: size num_var array
+    // A variable or constraint is basic if its entry is IPX_basic. If the
+    // number of basic entries is not num_constr, then the basis is ignored.
+    // If the basis is singular, it is repaired with slack variables.
+    // Returns:
+    // 0                            success
+    // IPX_ERROR_argument_null      an argument was NULL
+    // IPX_ERROR_not_implemented    the model was dualized during preprocessing
+    Int LoadIPMStartingBasis(const Int* cbasis, const Int* vbasis);
+
     // Solves the model that is currently loaded in the object.
     // Returns GetInfo().status.
     Int Solve();
@@ -98,10 +115,20 @@ public:
     Parameters GetParameters() const;
     void SetParameters(Parameters new_parameters);
 
+    // Sets a race timer so that the solve is interrupted, as if the time limit
+    // was reached, once another solver racing IPX has finished. @time_offset
+    // is the race time at which Solve() is called.
+    void SetRaceTimer(const HighsRaceTimer<double>* race_timer,
+                      double time_offset);
+
+    // Sets a stop token so that the solve is interrupted, as if the time
+    // limit was reached, once a stop is requested through it.
+    void SetStopToken(const HighsStopToken& stop_token);
+
     // Discards the model and solution (if any) but keeps the parameters.
     void ClearModel();
 
-    // Discards the starting point (if any).
+    // Discards the starting point and starting basis (if any).
     void ClearIPMStartingPoint();
 
     // Runs crossover for the given starting point. The starting point must be
@@ -160,6 +187,16 @@ public:
     Int SymbolicInvert(Int* rowcounts, Int* colcounts);
 
 private:
+    // If parameter kkt_solver is negative, then the IPM uses a Cholesky
+    // factorization of the normal matrix if the factor has at most
+    // kCholeskyMaxFill times the entries of AI. If kkt_solver is positive, it
+    // always uses the Cholesky factorization. Otherwise it uses the iterative
+    // KKT solvers with diagonal and basis preconditioning.
+    static constexpr double kCholeskyMaxFill = 10.0;
+    // Maximum # CR iterations per KKT solve with the Cholesky factorization
+    // before switching to basis preconditioning.
+    static constexpr Int kCholeskyMaxIter = 10;
+
     void ClearSolution();
     void InteriorPointSolve();
     void RunIPM();
@@ -168,6 +205,8 @@ private:
     void RunInitialIPM(IPM& ipm);
     void BuildStartingBasis();
     void RunMainIPM(IPM& ipm);
+    bool AnalyseCholesky(KKTSolverChol& kkt);
+    void RunCholeskyIPM(IPM& ipm, KKTSolverChol& kkt);
     void BuildCrossoverStartingPoint();
     void RunCrossover();
     void PrintSummary();
@@ -190,6 +229,10 @@ private:
 
     // IPM starting point provided by user (presolved).
     Vector x_start_, xl_start_, xu_start_, y_start_, zl_start_, zu_start_;
+
+    // IPM starting basis provided by user (presolved). Entry j is IPX_basic
+    // if variable j of the solver model is basic.
+    std::vector<Int> basic_status_start_;
 };
 
 }  // namespace ipx
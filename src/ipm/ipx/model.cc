@@ -220,6 +220,28 @@ Int Model::PresolveIPMStartingPoint(const double* x_user,
     return 0;
 }
 
+Int Model::PresolveBasis(const Int* cbasis_user, const Int* vbasis_user,
+                         std::vector<Int>& basic_status_solver) const {
+    if (!cbasis_user || !vbasis_user)
+        return IPX_ERROR_argument_null;
+    if (dualized_)
+        return IPX_ERROR_not_implemented;
+    const Int m = rows();
+    const Int n = cols();
+    assert(num_constr_ == m);
+    assert(num_var_ == n);
+
+    // Flipping variables in the scaling does not change which are basic.
+    basic_status_solver.resize(n+m);
+    for (Int j = 0; j < n; j++)
+        basic_status_solver[j] =
+            vbasis_user[j] == IPX_basic ? IPX_basic : IPX_nonbasic;
+    for (Int i = 0; i < m; i++)
+        basic_status_solver[n+i] =
+            cbasis_user[i] == IPX_basic ? IPX_basic : IPX_nonbasic;
+    return 0;
+}
+
 
 void Model::PostsolveInteriorSolution(const Vector& x_solver,
                                       const Vector& xl_solver,
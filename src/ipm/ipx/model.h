@@ -142,6 +142,18 @@ public:
                                  Vector& zl_solver,
                                  Vector& zu_solver) const;
 
+    // Transforms a basis from the user model to the solver model. On return
+    // basic_status_solver[j] is IPX_basic if variable j of the solver model
+    // is basic and IPX_nonbasic otherwise. The statuses are not checked to
+    // form a basis. At the moment PresolveBasis() is not implemented for the
+    // case that the model was dualized in preprocessing.
+    // Returns:
+    //  0
+    //  IPX_ERROR_argument_null
+    //  IPX_ERROR_not_implemented if the model was dualized in preprocessing.
+    Int PresolveBasis(const Int* cbasis_user, const Int* vbasis_user,
+                      std::vector<Int>& basic_status_solver) const;
+
     // Given an IPM iterate, recovers the solution to the user model (see the
     // reference documentation). Each of the pointer arguments can be NULL, in
     // which case the quantity is not returned. The sign conditions on the dual
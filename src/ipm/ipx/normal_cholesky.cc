@@ -0,0 +1,562 @@
+#include "ipm/ipx/normal_cholesky.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "ipm/ipx/timer.h"
+#include "ipm/ipx/utils.h"
+
+namespace ipx {
+
+NormalCholesky::NormalCholesky(const Model& model) : model_(model) {}
+
+bool NormalCholesky::Analyse(double max_fill) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    analysed_ = false;
+    factorized_ = false;
+
+    Int max_entries = -1;
+    if (max_fill >= 0.0) {
+        const double limit = max_fill * AI.entries();
+        // A structural column with c entries contributes up to c*(c-1)/2
+        // entries below the diagonal of (1). If that bound alone exceeds the
+        // limit, then the model has dense columns that make a direct method
+        // unattractive, and the graph of (1) is not built.
+        double pattern_bound = m;
+        for (Int j = 0; j < n; j++) {
+            const double c = AI.entries(j);
+            pattern_bound += 0.5 * c * (c-1.0);
+        }
+        if (pattern_bound > limit)
+            return false;
+        max_entries = (Int) std::min(
+            limit, (double) std::numeric_limits<Int>::max());
+    }
+
+    std::vector<Int> colptr, rowidx;
+    if (!MinimumDegree(max_entries, colptr, rowidx))
+        return false;
+    BuildSupernodes(colptr, rowidx);
+
+    diagonal_.resize(m);
+    work_.resize(m);
+    analysed_ = true;
+    return true;
+}
+
+bool NormalCholesky::MinimumDegree(Int max_entries, std::vector<Int>& colptr,
+                                   std::vector<Int>& rowidx) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+
+    // The quotient graph stores the list of node i in iw[pe[i]..pe[i]+len[i]).
+    // For a variable (uneliminated node) the list holds first elen[i]
+    // adjacent elements and then the adjacent variables. For an element
+    // (eliminated node) it holds the variables that form its clique, the
+    // number of which is esize[i]. Elements that are contained in another
+    // element are absorbed and their lists become garbage.
+    enum : char { kVariable, kElement, kAbsorbed };
+    std::vector<Int> iw, pe(m), len(m), elen(m, 0), esize(m, 0);
+    std::vector<char> status(m, kVariable);
+
+    // Initially there are no elements and the variable lists are the graph
+    // of (1). Slack columns only contribute to the diagonal.
+    std::vector<Int> mark(m, -1);
+    for (Int i = 0; i < m; i++) {
+        pe[i] = iw.size();
+        mark[i] = i;
+        for (Int p = AIt.begin(i); p < AIt.end(i); p++) {
+            const Int j = AIt.index(p);
+            if (j >= n)
+                continue;
+            for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                const Int i2 = AI.index(q);
+                if (mark[i2] != i) {
+                    mark[i2] = i;
+                    iw.push_back(i2);
+                }
+            }
+        }
+        len[i] = iw.size()-pe[i];
+    }
+    Int pfree = iw.size();
+    iw.resize(pfree + pfree/2 + m);
+
+    // Doubly linked lists of the variables by (approximate) degree.
+    std::vector<Int> head(m, -1), next(m, -1), prev(m, -1), degree(m);
+    auto insert = [&](Int i) {
+        const Int d = degree[i];
+        prev[i] = -1;
+        next[i] = head[d];
+        if (head[d] >= 0)
+            prev[head[d]] = i;
+        head[d] = i;
+    };
+    auto remove = [&](Int i) {
+        if (prev[i] >= 0)
+            next[prev[i]] = next[i];
+        else
+            head[degree[i]] = next[i];
+        if (next[i] >= 0)
+            prev[next[i]] = prev[i];
+    };
+    for (Int i = m-1; i >= 0; i--) {
+        degree[i] = len[i];
+        insert(i);
+    }
+
+    // Eliminate a variable p of minimum degree in each step. Its adjacent
+    // variables and the variables of its adjacent elements form the pattern
+    // Lp of the column of L. p becomes a new element with variables Lp and
+    // absorbs its adjacent elements. The external degree of each variable i
+    // in Lp is then bounded by
+    //
+    //   |Ai| + |Lp\i| + sum_{e in Ei, e != p} |Le\Lp|,
+    //
+    // which is the approximate degree of Amestoy, Davis and Duff.
+    perm_.resize(m);
+    iperm_.resize(m);
+    colptr.assign(1, 0);
+    rowidx.clear();
+    std::vector<Int> Lp, wext(m, -1), touched;
+    Int mindeg = 0;
+    double entries = 0.0;
+    for (Int k = 0; k < m; k++) {
+        while (head[mindeg] < 0)
+            mindeg++;
+        const Int p = head[mindeg];
+        remove(p);
+        perm_[k] = p;
+        iperm_[p] = k;
+
+        Lp.clear();
+        mark[p] = m+k;
+        for (Int q = pe[p]; q < pe[p]+len[p]; q++) {
+            const Int e = iw[q];
+            if (q < pe[p]+elen[p]) {
+                if (status[e] != kElement)
+                    continue;
+                for (Int r = pe[e]; r < pe[e]+len[e]; r++) {
+                    const Int i = iw[r];
+                    if (mark[i] != m+k) {
+                        mark[i] = m+k;
+                        Lp.push_back(i);
+                    }
+                }
+                status[e] = kAbsorbed;
+            } else if (mark[e] != m+k) {
+                mark[e] = m+k;
+                Lp.push_back(e);
+            }
+        }
+        const Int lpsize = Lp.size();
+        entries += 1 + lpsize;
+        if (max_entries >= 0 && entries > max_entries)
+            return false;
+        rowidx.insert(rowidx.end(), Lp.begin(), Lp.end());
+        colptr.push_back(rowidx.size());
+
+        // Store Lp as the list of element p. Compact the storage if the
+        // lists of absorbed elements and eliminated variables have left too
+        // little free space.
+        status[p] = kElement;
+        if (pfree + lpsize > (Int)iw.size()) {
+            std::vector<Int> iw2;
+            iw2.reserve(iw.size());
+            for (Int i = 0; i < m; i++) {
+                if (i == p || status[i] == kAbsorbed)
+                    continue;
+                const Int begin = pe[i];
+                pe[i] = iw2.size();
+                iw2.insert(iw2.end(), iw.begin()+begin,
+                           iw.begin()+begin+len[i]);
+            }
+            pfree = iw2.size();
+            iw2.resize(std::max((Int)iw.size(), pfree + lpsize + m));
+            iw = std::move(iw2);
+        }
+        std::copy(Lp.begin(), Lp.end(), iw.begin()+pfree);
+        pe[p] = pfree;
+        len[p] = lpsize;
+        elen[p] = 0;
+        esize[p] = lpsize;
+        pfree += lpsize;
+
+        // Compute |Le\Lp| for all elements e adjacent to Lp. An element with
+        // all its variables in Lp is absorbed into p.
+        for (Int i : Lp) {
+            for (Int q = pe[i]; q < pe[i]+elen[i]; q++) {
+                const Int e = iw[q];
+                if (status[e] != kElement)
+                    continue;
+                if (wext[e] < 0) {
+                    wext[e] = esize[e];
+                    touched.push_back(e);
+                }
+                wext[e]--;
+            }
+        }
+        for (Int e : touched) {
+            if (wext[e] == 0)
+                status[e] = kAbsorbed;
+        }
+
+        // Remove absorbed elements and the variables of Lp, which are now
+        // adjacent through p, from the lists of Lp. Then add p as element.
+        // Each list loses at least one entry, so it keeps its place in iw.
+        for (Int i : Lp) {
+            const Int begin = pe[i];
+            Int put = begin;
+            Int ext = 0;
+            for (Int q = begin; q < begin+elen[i]; q++) {
+                const Int e = iw[q];
+                if (status[e] == kElement) {
+                    iw[put++] = e;
+                    ext += wext[e];
+                }
+            }
+            const Int nelem = put-begin;
+            for (Int q = begin+elen[i]; q < begin+len[i]; q++) {
+                const Int j = iw[q];
+                if (status[j] == kVariable && mark[j] != m+k) {
+                    iw[put++] = j;
+                    ext++;
+                }
+            }
+            assert(put < begin+len[i]);
+            if (put > begin+nelem)
+                iw[put] = iw[begin+nelem];
+            iw[begin+nelem] = p;
+            elen[i] = nelem+1;
+            len[i] = put-begin+1;
+
+            Int d = std::min(ext + lpsize-1, degree[i] + lpsize-1);
+            d = std::min(d, m-k-2);
+            remove(i);
+            degree[i] = d;
+            insert(i);
+            mindeg = std::min(mindeg, d);
+        }
+        for (Int e : touched)
+            wext[e] = -1;
+        touched.clear();
+    }
+
+    // Rows of L in terms of elimination positions.
+    for (Int& i : rowidx)
+        i = iperm_[i];
+    return true;
+}
+
+void NormalCholesky::BuildSupernodes(const std::vector<Int>& colptr,
+                                     const std::vector<Int>& rowidx) {
+    const Int m = model_.rows();
+
+    // The parent of column k in the elimination tree is the smallest row
+    // index below the diagonal.
+    std::vector<Int> parent(m, -1);
+    for (Int k = 0; k < m; k++) {
+        for (Int p = colptr[k]; p < colptr[k+1]; p++) {
+            if (parent[k] < 0 || rowidx[p] < parent[k])
+                parent[k] = rowidx[p];
+        }
+    }
+
+    // Postorder the elimination tree. This does not change the fill but makes
+    // chains of columns with nested patterns consecutive.
+    std::vector<Int> first_child(m, -1), next_sibling(m, -1);
+    for (Int k = m-1; k >= 0; k--) {
+        if (parent[k] >= 0) {
+            next_sibling[k] = first_child[parent[k]];
+            first_child[parent[k]] = k;
+        }
+    }
+    std::vector<Int> post, ipost(m), stack;
+    post.reserve(m);
+    for (Int root = 0; root < m; root++) {
+        if (parent[root] >= 0)
+            continue;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const Int k = stack.back();
+            const Int child = first_child[k];
+            if (child >= 0) {
+                first_child[k] = next_sibling[child];
+                stack.push_back(child);
+            } else {
+                stack.pop_back();
+                ipost[k] = post.size();
+                post.push_back(k);
+            }
+        }
+    }
+    assert((Int)post.size() == m);
+
+    std::vector<Int> perm(m);
+    for (Int k = 0; k < m; k++) {
+        perm[k] = perm_[post[k]];
+        iperm_[perm[k]] = k;
+    }
+    perm_ = std::move(perm);
+
+    // Column patterns in the new order.
+    std::vector<Int> newptr(m+1), newidx(rowidx.size()), newparent(m);
+    newptr[0] = 0;
+    for (Int k = 0; k < m; k++) {
+        const Int old = post[k];
+        Int put = newptr[k];
+        for (Int p = colptr[old]; p < colptr[old+1]; p++)
+            newidx[put++] = ipost[rowidx[p]];
+        newptr[k+1] = put;
+        std::sort(newidx.begin() + newptr[k], newidx.begin() + put);
+        newparent[k] = parent[old] >= 0 ? ipost[parent[old]] : -1;
+    }
+
+    // Column k+1 joins the supernode of column k if it is the parent of k and
+    // the pattern of k is k+1 plus the pattern of k+1.
+    super_begin_.assign(1, 0);
+    col2super_.resize(m);
+    for (Int k = 0; k < m; k++) {
+        col2super_[k] = super_begin_.size()-1;
+        const bool extend = k+1 < m && newparent[k] == k+1 &&
+            newptr[k+1]-newptr[k] == newptr[k+2]-newptr[k+1]+1;
+        if (!extend)
+            super_begin_.push_back(k+1);
+    }
+    const Int nsuper = super_begin_.size()-1;
+
+    super_rowptr_.assign(1, 0);
+    super_rowidx_.clear();
+    super_valptr_.assign(1, 0);
+    nnz_factor_ = 0;
+    flops_ = 0.0;
+    Int max_rows = 0;
+    Int max_block = 0;
+    for (Int s = 0; s < nsuper; s++) {
+        const Int f = super_begin_[s];
+        const Int ncol = super_begin_[s+1]-f;
+        super_rowidx_.push_back(f);
+        super_rowidx_.insert(super_rowidx_.end(), newidx.begin() + newptr[f],
+                             newidx.begin() + newptr[f+1]);
+        super_rowptr_.push_back(super_rowidx_.size());
+        const Int nrow = super_rowptr_[s+1]-super_rowptr_[s];
+        super_valptr_.push_back(super_valptr_[s] + nrow*ncol);
+        max_rows = std::max(max_rows, nrow);
+        max_block = std::max(max_block, nrow*ncol);
+        for (Int c = 0; c < ncol; c++) {
+            const double colcount = nrow-c;
+            nnz_factor_ += nrow-c;
+            flops_ += colcount * colcount;
+        }
+    }
+    values_.resize(super_valptr_[nsuper]);
+    relpos_.resize(max_rows);
+    update_.resize(max_block);
+}
+
+void NormalCholesky::Factorize(const double* W) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    const SparseMatrix& AIt = model_.AIt();
+    const Int nsuper = supernodes();
+    assert(analysed_);
+    factorized_ = false;
+
+    // Assemble the lower triangle of (1) in elimination order.
+    std::fill(values_.begin(), values_.end(), 0.0);
+    std::vector<Int> rowpos(m);
+    for (Int s = 0; s < nsuper; s++) {
+        const Int f = super_begin_[s];
+        const Int nrow = super_rowptr_[s+1]-super_rowptr_[s];
+        const Int* rows = &super_rowidx_[super_rowptr_[s]];
+        double* block = &values_[super_valptr_[s]];
+        for (Int pos = 0; pos < nrow; pos++)
+            rowpos[rows[pos]] = pos;
+        for (Int k = f; k < super_begin_[s+1]; k++) {
+            double* col = block + (k-f)*nrow;
+            const Int i = perm_[k];
+            for (Int p = AIt.begin(i); p < AIt.end(i); p++) {
+                const Int j = AIt.index(p);
+                const double w = W ? W[j] : j < n ? 1.0 : 0.0;
+                if (w == 0.0)
+                    continue;
+                const double a = w * AIt.value(p);
+                for (Int q = AI.begin(j); q < AI.end(j); q++) {
+                    const Int k2 = iperm_[AI.index(q)];
+                    if (k2 >= k)
+                        col[rowpos[k2]] += a * AI.value(q);
+                }
+            }
+            diagonal_[k] = col[k-f];
+        }
+    }
+
+    dropped_pivots_ = 0;
+    for (Int s = 0; s < nsuper; s++) {
+        FactorizeSupernode(s);
+        UpdateFromSupernode(s);
+    }
+    factorized_ = true;
+}
+
+// Factorizes the dense block of supernode s, to which all updates from
+// previous supernodes have been applied.
+void NormalCholesky::FactorizeSupernode(Int s) {
+    const Int f = super_begin_[s];
+    const Int ncol = super_begin_[s+1]-f;
+    const Int nrow = super_rowptr_[s+1]-super_rowptr_[s];
+    double* L = &values_[super_valptr_[s]];
+    for (Int c = 0; c < ncol; c++) {
+        double* colc = L + c*nrow;
+        double d = colc[c];
+        if (!(d > kPivotDropTol * diagonal_[f+c])) {
+            d = kHugePivot;
+            dropped_pivots_++;
+        }
+        d = std::sqrt(d);
+        colc[c] = d;
+        for (Int i = c+1; i < nrow; i++)
+            colc[i] /= d;
+        for (Int c2 = c+1; c2 < ncol; c2++) {
+            const double l = colc[c2];
+            if (l == 0.0)
+                continue;
+            double* col2 = L + c2*nrow;
+            for (Int i = c2; i < nrow; i++)
+                col2[i] -= l * colc[i];
+        }
+    }
+}
+
+// Subtracts L21*L21' from the supernodes that own the rows of L21, where L21
+// is the part of supernode s below its diagonal block. For each target
+// supernode t the rows of L21 split into a block R1 that belongs to the
+// columns of t and the block R2 below. The dense block [R1;R2]*R1' is formed
+// in update_ by ncol rank-one updates of contiguous columns and is then
+// scattered into t.
+void NormalCholesky::UpdateFromSupernode(Int s) {
+    const Int ncol = super_begin_[s+1]-super_begin_[s];
+    const Int nrow = super_rowptr_[s+1]-super_rowptr_[s];
+    const Int* rows = &super_rowidx_[super_rowptr_[s]];
+    const double* L = &values_[super_valptr_[s]];
+
+    Int first = ncol;
+    while (first < nrow) {
+        const Int t = col2super_[rows[first]];
+        const Int tbegin = super_begin_[t];
+        const Int tend = super_begin_[t+1];
+        const Int tnrow = super_rowptr_[t+1]-super_rowptr_[t];
+        const Int* trows = &super_rowidx_[super_rowptr_[t]];
+        double* Lt = &values_[super_valptr_[t]];
+
+        // The remaining rows of s are a subset of the rows of t.
+        Int pos = 0;
+        for (Int r = first; r < nrow; r++) {
+            while (trows[pos] != rows[r])
+                pos++;
+            relpos_[r] = pos;
+        }
+        Int last = first;
+        while (last < nrow && rows[last] < tend)
+            last++;
+
+        // Column r-first of the update block has leading dimension ldu and
+        // holds the entries in rows r..nrow-1 of s.
+        const Int ldu = nrow-first;
+        const Int nupd = last-first;
+        std::fill(update_.begin(), update_.begin() + ldu*nupd, 0.0);
+        for (Int c = 0; c < ncol; c++) {
+            const double* colc = L + c*nrow;
+            for (Int r = first; r < last; r++) {
+                const double l = colc[r];
+                if (l == 0.0)
+                    continue;
+                double* upd = &update_[(r-first)*ldu];
+                for (Int i = r; i < nrow; i++)
+                    upd[i-first] += l * colc[i];
+            }
+        }
+        for (Int r = first; r < last; r++) {
+            const double* upd = &update_[(r-first)*ldu];
+            double* colt = Lt + (rows[r]-tbegin)*tnrow;
+            if (relpos_[nrow-1]-relpos_[r] == nrow-1-r) {
+                // Rows r..nrow-1 of s are consecutive rows of t.
+                double* dst = colt + relpos_[r];
+                for (Int i = r; i < nrow; i++)
+                    dst[i-r] -= upd[i-first];
+            } else {
+                for (Int i = r; i < nrow; i++)
+                    colt[relpos_[i]] -= upd[i-first];
+            }
+        }
+        first = last;
+    }
+}
+
+double NormalCholesky::time() const {
+    return time_;
+}
+
+void NormalCholesky::reset_time() {
+    time_ = 0.0;
+}
+
+void NormalCholesky::_Apply(const Vector& rhs, Vector& lhs,
+                            double* rhs_dot_lhs) {
+    const Int m = model_.rows();
+    const Int nsuper = supernodes();
+    Timer timer;
+
+    assert(factorized_);
+    assert((Int)lhs.size() == m);
+    assert((Int)rhs.size() == m);
+
+    for (Int k = 0; k < m; k++)
+        work_[k] = rhs[perm_[k]];
+
+    // Solve with L.
+    for (Int s = 0; s < nsuper; s++) {
+        const Int f = super_begin_[s];
+        const Int ncol = super_begin_[s+1]-f;
+        const Int nrow = super_rowptr_[s+1]-super_rowptr_[s];
+        const Int* rows = &super_rowidx_[super_rowptr_[s]];
+        const double* L = &values_[super_valptr_[s]];
+        for (Int c = 0; c < ncol; c++) {
+            const double* colc = L + c*nrow;
+            const double x = work_[f+c] /= colc[c];
+            if (x == 0.0)
+                continue;
+            for (Int i = c+1; i < nrow; i++)
+                work_[rows[i]] -= colc[i] * x;
+        }
+    }
+
+    // Solve with L'.
+    for (Int s = nsuper-1; s >= 0; s--) {
+        const Int f = super_begin_[s];
+        const Int ncol = super_begin_[s+1]-f;
+        const Int nrow = super_rowptr_[s+1]-super_rowptr_[s];
+        const Int* rows = &super_rowidx_[super_rowptr_[s]];
+        const double* L = &values_[super_valptr_[s]];
+        for (Int c = ncol-1; c >= 0; c--) {
+            const double* colc = L + c*nrow;
+            double x = work_[f+c];
+            for (Int i = c+1; i < nrow; i++)
+                x -= colc[i] * work_[rows[i]];
+            work_[f+c] = x / colc[c];
+        }
+    }
+
+    for (Int k = 0; k < m; k++)
+        lhs[perm_[k]] = work_[k];
+    if (rhs_dot_lhs)
+        *rhs_dot_lhs = Dot(rhs,lhs);
+    time_ += timer.Elapsed();
+}
+
+}  // namespace ipx
@@ -0,0 +1,113 @@
+#ifndef IPX_NORMAL_CHOLESKY_H_
+#define IPX_NORMAL_CHOLESKY_H_
+
+#include <vector>
+#include "ipm/ipx/linear_operator.h"
+#include "ipm/ipx/model.h"
+#include "ipm/ipx/sparse_matrix.h"
+
+namespace ipx {
+
+// NormalCholesky provides inverse operations with the normal matrix
+//
+//   AI*W*AI'                                       (1)
+//
+// by a sparse Cholesky factorization P*(1)*P' = L*L'. Here AI is the
+// m-by-(n+m) matrix defined by the model, and W is a diagonal (weight) matrix
+// that is provided by the user. The permutation P is an approximate minimum
+// degree ordering of the sparsity pattern of (1). L is stored by supernodes,
+// which are sets of consecutive columns with the same pattern below the
+// diagonal block, as dense column-major blocks.
+//
+// Pivots that are tiny compared to the diagonal entry of (1) are replaced by a
+// huge value, which removes the corresponding direction from the factor. The
+// factorization is then a preconditioner for (1) rather than its inverse.
+
+class NormalCholesky : public LinearOperator {
+public:
+    // Constructor stores a reference to the model. No data is copied. The model
+    // must be valid as long as the factorization is used.
+    explicit NormalCholesky(const Model& model);
+
+    // Computes the ordering and the sparsity pattern of L. If @max_fill >= 0,
+    // the analysis stops as soon as it is clear that L would have more than
+    // @max_fill times the entries of AI. Returns true if the analysis is
+    // complete, in which case Factorize() can be called.
+    bool Analyse(double max_fill);
+
+    // Factorizes (1). W must either hold n+m entries, or be NULL, in which
+    // case the first n entries are assumed 1.0 and the last m entries are
+    // assumed 0.0. Analyse() must have returned true.
+    void Factorize(const double* W);
+
+    // Returns the # entries in L, the # floating point operations in
+    // Factorize() and the # supernodes.
+    Int entries() const { return nnz_factor_; }
+    double flops() const { return flops_; }
+    Int supernodes() const { return (Int)super_begin_.size()-1; }
+
+    // Returns the # pivots that were replaced in the last Factorize().
+    Int dropped_pivots() const { return dropped_pivots_; }
+
+    // Returns computation time for calls to Apply() since last reset_time().
+    double time() const;
+    void reset_time();
+
+private:
+    // A pivot is replaced by kHugePivot if it is not larger than
+    // kPivotDropTol times the diagonal entry of (1).
+    static constexpr double kPivotDropTol = 1e-30;
+    static constexpr double kHugePivot = 1e128;
+
+    void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+
+    // Computes an approximate minimum degree ordering of the graph of (1) by
+    // elimination in the quotient graph. Stores the pattern of column k of L
+    // in @colptr, @rowidx in terms of the elimination positions. Returns
+    // false if the factor would have more than @max_entries entries (if
+    // @max_entries >= 0).
+    bool MinimumDegree(Int max_entries, std::vector<Int>& colptr,
+                       std::vector<Int>& rowidx);
+
+    // Renumbers the columns in a postorder of the elimination tree, so that
+    // the columns of a supernode are consecutive, and builds the supernodes.
+    void BuildSupernodes(const std::vector<Int>& colptr,
+                         const std::vector<Int>& rowidx);
+
+    void FactorizeSupernode(Int s);
+    void UpdateFromSupernode(Int s);
+
+    const Model& model_;
+    bool analysed_{false};
+    bool factorized_{false};
+
+    std::vector<Int> perm_;     // row perm_[k] of AI is eliminated k-th
+    std::vector<Int> iperm_;    // inverse permutation
+
+    // Supernode s consists of columns super_begin_[s]..super_begin_[s+1]-1.
+    // Its rows are super_rowidx_[super_rowptr_[s]..super_rowptr_[s+1]-1] in
+    // increasing order, the first of which are the columns of the supernode.
+    // Its entries are stored column-wise in a dense block that starts at
+    // values_[super_valptr_[s]] and has leading dimension equal to the
+    // number of rows.
+    std::vector<Int> super_begin_;
+    std::vector<Int> super_rowptr_;
+    std::vector<Int> super_rowidx_;
+    std::vector<Int> super_valptr_;
+    std::vector<Int> col2super_;
+    std::vector<double> values_;
+
+    std::vector<double> diagonal_;  // diagonal of (1) in elimination order
+    std::vector<Int> relpos_;       // workspace for relative row positions
+    std::vector<double> update_;    // workspace for a dense update block
+    Vector work_;                   // size m workspace for solves
+
+    Int nnz_factor_{0};
+    double flops_{0.0};
+    Int dropped_pivots_{0};
+    double time_{0.0};
+};
+
+}  // namespace ipx
+
+#endif  // IPX_NORMAL_CHOLESKY_H_
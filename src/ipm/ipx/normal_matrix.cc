@@ -17,6 +17,10 @@ namespace ipx {
 // is the fastest on average (about 20% better than the best two-pass variant),
 // and also the fastest on most LP models. Therefore, it is used for
 // matrix-vector products of the form AA' here and in SplittedNormalMatrix.
+//
+// Independently of the method, if W != NULL and UseParallelProducts() holds
+// for AI, which requires more than one worker of the scheduler, then method 2
+// is used in fixed blocks with each pass shared between the workers.
 #define MATVECMETHOD 1
 
 NormalMatrix::NormalMatrix(const Model& model) : model_(model) {
@@ -29,6 +33,9 @@ NormalMatrix::NormalMatrix(const Model& model) : model_(model) {
 
 void NormalMatrix::Prepare(const double* W) {
     W_ = W;
+    parallel_ = W && UseParallelProducts(model_.AI().entries());
+    if (parallel_)
+        work_.resize(model_.rows() + model_.cols());
     prepared_ = true;
 }
 
@@ -58,7 +65,9 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     assert((Int)lhs.size() == m);
     assert((Int)rhs.size() == m);
 
-    if (W_) {
+    if (parallel_) {
+        ParallelNormalProduct(model_.AI(), model_.AIt(), W_, rhs, lhs, work_);
+    } else if (W_) {
         #if MATVECMETHOD == 1
         for (Int i = 0; i < m; i++)
             lhs[i] = rhs[i] * W_[n+i];
@@ -119,7 +128,7 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
         }
     }
     if (rhs_dot_lhs)
-        *rhs_dot_lhs = Dot(rhs,lhs);
+        *rhs_dot_lhs = parallel_ ? ParallelDot(rhs,lhs) : Dot(rhs,lhs);
     time_ += timer.Elapsed();
 }
 
@@ -35,6 +35,7 @@ private:
     const Model& model_;
     const double* W_{nullptr};
     bool prepared_{false};
+    bool parallel_{false};   // share products between workers?
     Vector work_;            // size n+m workspace (2-pass matvec products only)
     double time_{0.0};
 };
@@ -4,6 +4,7 @@
 #include <cmath>
 #include <utility>
 #include "ipm/ipx/utils.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 
 namespace ipx {
@@ -220,6 +221,36 @@ void AddNormalProduct(const SparseMatrix& A, const double* D, const Vector& rhs,
     }
 }
 
+// Returns the number of columns of A in a block of about
+// kParallelProductBlockNnz entries.
+static Int ParallelBlockSize(const SparseMatrix& A) {
+    const Int ncol = A.cols();
+    const Int nnz = std::max(A.entries(), (Int)1);
+    return std::max(
+        (Int)((double)ncol * kParallelProductBlockNnz / nnz), (Int)1);
+}
+
+void ParallelNormalProduct(const SparseMatrix& A, const SparseMatrix& At,
+                           const double* colweight, const Vector& rhs,
+                           Vector& lhs, Vector& work) {
+    const Int m = A.rows();
+    const Int n = A.cols();
+    assert(At.rows() == n && At.cols() == m);
+    assert((Int)rhs.size() == m);
+    assert((Int)lhs.size() == m);
+    assert((Int)work.size() == n);
+    highs::parallel::for_each_block(0, n, [&](Int begin, Int end) {
+        for (Int j = begin; j < end; j++) {
+            double d = DotColumn(A, j, rhs);
+            work[j] = colweight ? d * colweight[j] : d;
+        }
+    }, ParallelBlockSize(A));
+    highs::parallel::for_each_block(0, m, [&](Int begin, Int end) {
+        for (Int i = begin; i < end; i++)
+            lhs[i] = DotColumn(At, i, work);
+    }, ParallelBlockSize(At));
+}
+
 Int TriangularSolve(const SparseMatrix& A, Vector& x, char trans,
                     const char* uplo, int unitdiag) {
     const Int ncol = A.cols();
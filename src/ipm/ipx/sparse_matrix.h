@@ -159,6 +159,17 @@ void MultiplyAdd(const SparseMatrix& A, const Vector& rhs, double alpha,
 void AddNormalProduct(const SparseMatrix& A, const double* D, const Vector& rhs,
                       Vector& lhs);
 
+// Computes lhs := A*W*A'*rhs, where W is the diagonal matrix with entries
+// @colweight, or the identity if @colweight == NULL. @At must be the transpose
+// of A. The product is formed in two passes, the first over the columns of A
+// and the second over the columns of At, each shared between the workers of
+// the scheduler. As each entry of the result is computed by one worker in a
+// fixed order, the result does not depend on the number of threads.
+// @work: size A.cols() workspace.
+void ParallelNormalProduct(const SparseMatrix& A, const SparseMatrix& At,
+                           const double* colweight, const Vector& rhs,
+                           Vector& lhs, Vector& work);
+
 // Triangular solve with sparse matrix.
 // @x: right-hand side on entry, left-hand side on return.
 // @trans: 't' or 'T' for transposed system.
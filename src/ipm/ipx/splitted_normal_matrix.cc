@@ -1,4 +1,5 @@
 #include "ipm/ipx/splitted_normal_matrix.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include "ipm/ipx/timer.h"
@@ -19,7 +20,6 @@ void SplittedNormalMatrix::Prepare(const Basis& basis, const double* colscale) {
     const SparseMatrix& AI = model_.AI();
     assert(colscale);
     prepared_ = false;
-    N_.clear();                 // deallocate old memory
 
     basis.GetLuFactors(&L_, &U_, rowperm_inv_.data(), colperm_.data());
     rowperm_inv_ = InversePerm(rowperm_inv_);
@@ -36,20 +36,51 @@ void SplittedNormalMatrix::Prepare(const Basis& basis, const double* colscale) {
         }
     }
 
-    // Build N with permuted row indices.
+    // Build N with permuted row indices, and its transpose if products with
+    // N*N' are blocked. Both keep their pattern while the nonbasic variables
+    // and the row permutation are unchanged, in which case only their values
+    // are refreshed below.
     std::vector<Int> nonbasic_vars;
     for (Int j = 0; j < n+m; j++)
         if (basis.StatusOf(j) == Basis::NONBASIC)
             nonbasic_vars.push_back(j);
-    N_ = CopyColumns(AI, nonbasic_vars);
-    PermuteRows(N_, rowperm_inv_);
+    const bool new_pattern =
+        nonbasic_vars != nonbasic_vars_ || rowperm_inv_ != N_rowperm_inv_;
+    if (new_pattern) {
+        nonbasic_vars_ = std::move(nonbasic_vars);
+        N_rowperm_inv_ = rowperm_inv_;
+        N_ = CopyColumns(AI, nonbasic_vars_);
+        PermuteRows(N_, rowperm_inv_);
+    }
+    // Products with N*N' are blocked in two passes, the second of which is
+    // over the columns of N'.
+    const bool was_parallel = parallel_;
+    parallel_ = UseParallelProducts(N_.entries());
+    if (parallel_ && (new_pattern || !was_parallel)) {
+        Transpose(N_, Nt_);
+        work_N_.resize(N_.cols());
+        Nt_next_.resize(m);
+    } else if (!parallel_) {
+        Nt_.clear();
+        work_N_.resize(0);
+        Nt_next_.clear();
+    }
 
     // Scale columns of N.
-    for (Int k = 0; k < (Int)nonbasic_vars.size(); k++) {
-        Int j = nonbasic_vars[k];
+    for (Int k = 0; k < (Int)nonbasic_vars_.size(); k++) {
+        Int j = nonbasic_vars_[k];
         double d = colscale[j];
         assert(std::isfinite(d));
-        ScaleColumn(N_, k, d);
+        Int put = N_.begin(k);
+        for (Int p = AI.begin(j); p < AI.end(j); p++)
+            N_.value(put++) = AI.value(p) * d;
+    }
+    // Copy the values of N into Nt_ in the order of Transpose().
+    if (parallel_) {
+        std::copy_n(Nt_.colptr(), m, Nt_next_.begin());
+        for (Int k = 0; k < N_.cols(); k++)
+            for (Int p = N_.begin(k); p < N_.end(k); p++)
+                Nt_.value(Nt_next_[N_.index(p)]++) = N_.value(p);
     }
 
     // Build list of free variables.
@@ -97,9 +128,13 @@ void SplittedNormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     time_Bt_ += timer.Elapsed();
 
     // Compute lhs = N*N' * work.
-    lhs = 0.0;
     timer.Reset();
-    AddNormalProduct(N_, nullptr, work_, lhs);
+    if (parallel_) {
+        ParallelNormalProduct(N_, Nt_, nullptr, work_, lhs, work_N_);
+    } else {
+        lhs = 0.0;
+        AddNormalProduct(N_, nullptr, work_, lhs);
+    }
     time_NNt_ += timer.Elapsed();
 
     // Compute lhs := inverse(B) * lhs.
@@ -111,7 +146,7 @@ void SplittedNormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     for (Int i : free_positions_)
         lhs[i] = 0.0;
     if (rhs_dot_lhs)
-        *rhs_dot_lhs = Dot(rhs,lhs);
+        *rhs_dot_lhs = parallel_ ? ParallelDot(rhs,lhs) : Dot(rhs,lhs);
 }
 
 }  // namespace ipx
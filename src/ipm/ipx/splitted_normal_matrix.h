@@ -48,10 +48,16 @@ private:
     SparseMatrix L_;           // lower triangular factor without unit diagonal
     SparseMatrix U_;           // upper triangular factor with scaled columns
     SparseMatrix N_;           // N with scaled columns and permuted row indices
+    SparseMatrix Nt_;          // transpose of N_ if products are blocked
+    std::vector<Int> nonbasic_vars_;  // variables in the columns of N_
+    std::vector<Int> N_rowperm_inv_;  // row permutation applied to N_
+    std::vector<Int> Nt_next_;        // size m workspace if blocked
     std::vector<Int> free_positions_; // positions corresponding to free vars
     std::vector<Int> colperm_;        // column permutation from LU factor
     std::vector<Int> rowperm_inv_;    // inverse row permutation from LU factor
     Vector work_;                     // size m workspace
+    Vector work_N_;                   // size N_.cols() workspace if parallel
+    bool parallel_{false};            // blocked products with N_ and Nt_?
     bool prepared_{false};            // operator prepared?
     double time_B_{0.0};              // time solves with B
     double time_Bt_{0.0};             // time solves with B'
@@ -124,7 +124,8 @@ static void PostprocessDependencies(Iterate* iterate, Basis* p_basis,
     }
 }
 
-void StartingBasis(Iterate* iterate, Basis* p_basis, Info* info) {
+void StartingBasis(Iterate* iterate, Basis* p_basis, Info* info,
+                   const Int* basic_status) {
     const Model& model = iterate->model();
     const Int m = model.rows();
     const Int n = model.cols();
@@ -135,9 +136,9 @@ void StartingBasis(Iterate* iterate, Basis* p_basis, Info* info) {
     info->errflag = 0;
     Timer timer;
 
-    // Construct starting basis. The column weights for the crash procedure are
-    // the interior point scaling factors from the current iterate, except that
-    // fixed variables get weight zero.
+    // Construct starting basis. The column weights for the crash procedure
+    // (or for completing a given basis) are the interior point scaling factors
+    // from the current iterate, except that fixed variables get weight zero.
     for (Int j = 0; j < n+m; j++) {
         colscale[j] = iterate->ScalingFactor(j);
         if (std::isinf(lb[j]) && std::isinf(ub[j]))
@@ -147,7 +148,10 @@ void StartingBasis(Iterate* iterate, Basis* p_basis, Info* info) {
         if (lb[j] == ub[j])
             colscale[j] = 0.0;
     }
-    basis.ConstructBasisFromWeights(&colscale[0], info);
+    if (basic_status)
+        basis.ConstructBasisFromStart(basic_status, &colscale[0], info);
+    else
+        basis.ConstructBasisFromWeights(&colscale[0], info);
     if (info->errflag)
         return;
 
@@ -28,11 +28,14 @@ namespace ipx {
 // TODO: we need to check for primal/dual infeasibility here.
 //
 // The method calls ConstructBasisFromWeights() using the interior point
-// scaling factors as column weights. If a variable gets status BASIC_FREE or
+// scaling factors as column weights. If @basic_status is not NULL, it calls
+// ConstructBasisFromStart() instead, which starts from the columns with
+// basic_status[j] == IPX_basic. If a variable gets status BASIC_FREE or
 // NONBASIC_FIXED, then its state in @iterate is changed accordingly to free or
 // fixed. On return info->errflag is nonzero if an error occured.
 //
-void StartingBasis(Iterate* iterate, Basis* basis, Info* info);
+void StartingBasis(Iterate* iterate, Basis* basis, Info* info,
+                   const Int* basic_status = nullptr);
 
 }  // namespace ipx
 
@@ -3,6 +3,7 @@
 #include <cassert>
 #include <cmath>
 #include <utility>
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 
 namespace ipx {
@@ -43,6 +44,35 @@ double Dot(const Vector& x, const Vector& y) {
     return d;
 }
 
+// Matrix-vector products with fewer than four blocks of entries are not worth
+// sharing between workers.
+static constexpr Int kParallelProductMinNnz = 4 * kParallelProductBlockNnz;
+
+// Number of entries in each block of a dot product that is shared between
+// workers.
+static constexpr Int kParallelDotBlockSize = 4096;
+
+bool UseParallelProducts(Int nnz) {
+    if (nnz < kParallelProductMinNnz)
+        return false;
+    HighsSplitDeque* worker_deque = HighsTaskExecutor::getThisWorkerDeque();
+    return worker_deque && worker_deque->getNumWorkers() > 1;
+}
+
+double ParallelDot(const Vector& x, const Vector& y) {
+    assert(x.size() == y.size());
+    return highs::parallel::reduce(
+        0, (Int)x.size(), 0.0,
+        [&](Int begin, Int end) {
+            double d = 0.0;
+            for (Int i = begin; i < end; i++)
+                d += x[i]*y[i];
+            return d;
+        },
+        [](double sum, double block_sum) { return sum + block_sum; },
+        kParallelDotBlockSize);
+}
+
 Int FindMaxAbs(const Vector& x) {
     double xmax = 0.0;
     Int imax = 0;
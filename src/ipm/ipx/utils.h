@@ -13,6 +13,23 @@ double Twonorm(const Vector& x);
 double Infnorm(const Vector& x);
 double Dot(const Vector& x, const Vector& y);
 
+// Number of matrix entries in each block of a matrix-vector product that is
+// shared between the workers of the scheduler.
+constexpr Int kParallelProductBlockNnz = 8192;
+
+// Returns true if matrix-vector products with a matrix with @nnz entries are
+// computed in fixed blocks, which are shared between the workers of the
+// scheduler of the calling thread. This requires more than one worker, since
+// the serial one-pass product is faster. The blocks only depend on the
+// matrix, so that the result does not depend on the number of workers once
+// there is more than one.
+bool UseParallelProducts(Int nnz);
+
+// Returns the dot product of x and y, summing over fixed blocks of entries
+// that are shared between the workers of the scheduler. The partial sums are
+// combined in order, so the result does not depend on the number of threads.
+double ParallelDot(const Vector& x, const Vector& y);
+
 // Returns the index of an entry of maximum absolute value.
 Int FindMaxAbs(const Vector& x);
 
@@ -201,8 +201,9 @@ enum class HighsModelStatus {
   // highs_c_api.h, highs_csharp_api.cs, highspy/highs_bindings.cpp
   kUnknown,
   kSolutionLimit,
+  kInterrupt,
   kMin = kNotset,
-  kMax = kSolutionLimit
+  kMax = kInterrupt
 };
 
 /** SCIP/CPLEX-like HiGHS basis status for columns and rows. */
@@ -709,19 +709,10 @@ HighsStatus Highs::presolve() {
     model_presolve_status_ = HighsPresolveStatus::kNotReduced;
   } else {
     const bool force_presolve = true;
-    // make sure global scheduler is initialized before calling presolve, since
+    // make sure the scheduler is initialized before calling presolve, since
     // MIP presolve may use parallelism
-    highs::parallel::initialize_scheduler(options_.threads);
-    max_threads = highs::parallel::num_threads();
-    if (options_.threads != 0 && max_threads != options_.threads) {
-      highsLogUser(
-          options_.log_options, HighsLogType::kError,
-          "Option 'threads' is set to %d but global scheduler has already been "
-          "initialized to use %d threads. The previous scheduler instance can "
-          "be destroyed by calling Highs::resetGlobalScheduler().\n",
-          (int)options_.threads, max_threads);
-      return HighsStatus::kError;
-    }
+    if (initializeScheduler() != HighsStatus::kOk) return HighsStatus::kError;
+    HighsTaskExecutor::ScopedExecutor scoped_executor(instance_scheduler_);
     model_presolve_status_ = runPresolve(force_presolve);
   }
 
@@ -819,18 +810,10 @@ HighsStatus Highs::run() {
   if (ekk_instance_.status_.has_nla)
     assert(ekk_instance_.lpFactorRowCompatible(model_.lp_.num_row_));
 
-  highs::parallel::initialize_scheduler(options_.threads);
-
-  max_threads = highs::parallel::num_threads();
-  if (options_.threads != 0 && max_threads != options_.threads) {
-    highsLogUser(
-        options_.log_options, HighsLogType::kError,
-        "Option 'threads' is set to %d but global scheduler has already been "
-        "initialized to use %d threads. The previous scheduler instance can "
-        "be destroyed by calling Highs::resetGlobalScheduler().\n",
-        (int)options_.threads, max_threads);
-    return HighsStatus::kError;
-  }
+  if (initializeScheduler() != HighsStatus::kOk) return HighsStatus::kError;
+  // Any scheduler owned by this instance is used until run() returns
+  HighsTaskExecutor::ScopedExecutor scoped_executor(instance_scheduler_);
+  scheduler_stats_ = HighsTaskExecutor::getWorkerStats(schedulerHandle());
   assert(max_threads > 0);
   if (max_threads <= 0)
     highsLogDev(options_.log_options, HighsLogType::kWarning,
@@ -1219,7 +1202,8 @@ HighsStatus Highs::run() {
             model_status_ == HighsModelStatus::kUnbounded ||
             model_status_ == HighsModelStatus::kUnboundedOrInfeasible ||
             model_status_ == HighsModelStatus::kTimeLimit ||
-            model_status_ == HighsModelStatus::kIterationLimit;
+            model_status_ == HighsModelStatus::kIterationLimit ||
+            model_status_ == HighsModelStatus::kInterrupt;
         break;
       }
       case HighsPresolveStatus::kReducedToEmpty: {
@@ -1387,7 +1371,9 @@ HighsStatus Highs::run() {
             if (full_logging) options_.log_dev_level = kHighsLogDevLevelVerbose;
             // Force the use of simplex to clean up if IPM has been used
             // to solve the presolved problem
-            if (options_.solver == kIpmString) options_.solver = kSimplexString;
+            if (options_.solver == kIpmString ||
+                options_.solver == kConcurrentString)
+              options_.solver = kSimplexString;
             options_.simplex_strategy = kSimplexStrategyChoose;
             // Ensure that the parallel solver isn't used
             options_.simplex_min_concurrency = 1;
@@ -1455,6 +1441,7 @@ HighsStatus Highs::run() {
            model_status_ == HighsModelStatus::kUnboundedOrInfeasible ||
            model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
+           model_status_ == HighsModelStatus::kInterrupt ||
            model_status_ == HighsModelStatus::kUnknown);
     // The HEkk data correspond to the (strictly reduced) presolved LP
     // so must be cleared
@@ -1569,6 +1556,41 @@ HighsStatus Highs::getRanging(HighsRanging& ranging) {
   return return_status;
 }
 
+HighsStatus Highs::getRanging(HighsRanging& ranging,
+                              const HighsInt num_set_col,
+                              const HighsInt* col_set,
+                              const HighsInt num_set_row,
+                              const HighsInt* row_set) {
+  const HighsInt num_col = model_.lp_.num_col_;
+  const HighsInt num_row = model_.lp_.num_row_;
+  std::vector<int8_t> variable_mask(num_col + num_row, 0);
+  for (HighsInt k = 0; k < num_set_col; k++) {
+    const HighsInt iCol = col_set[k];
+    if (iCol < 0 || iCol >= num_col) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "Column %" HIGHSINT_FORMAT
+                   " out of range [0, %" HIGHSINT_FORMAT "] in getRanging\n",
+                   iCol, num_col - 1);
+      return HighsStatus::kError;
+    }
+    variable_mask[iCol] = 1;
+  }
+  for (HighsInt k = 0; k < num_set_row; k++) {
+    const HighsInt iRow = row_set[k];
+    if (iRow < 0 || iRow >= num_row) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "Row %" HIGHSINT_FORMAT
+                   " out of range [0, %" HIGHSINT_FORMAT "] in getRanging\n",
+                   iRow, num_row - 1);
+      return HighsStatus::kError;
+    }
+    variable_mask[num_col + iRow] = 1;
+  }
+  HighsStatus return_status = getRangingInterface(&variable_mask);
+  ranging = this->ranging_;
+  return return_status;
+}
+
 bool Highs::hasInvert() const { return ekk_instance_.status_.has_invert; }
 
 const HighsInt* Highs::getBasicVariablesArray() const {
@@ -3055,6 +3077,7 @@ HighsStatus Highs::callSolveLp(HighsLp& lp, const string message) {
 
   HighsLpSolverObject solver_object(lp, basis_, solution_, info_, ekk_instance_,
                                     options_, timer_);
+  solver_object.stop_token_ = stop_token_;
 
   // Check that the model is column-wise
   assert(model_.lp_.a_matrix_.isColwise());
@@ -3256,6 +3279,7 @@ HighsStatus Highs::callSolveMip() {
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
   HighsMipSolver solver(options_, lp, solution_);
+  solver.stop_token_ = stop_token_;
   solver.run();
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
@@ -3302,6 +3326,7 @@ HighsStatus Highs::callSolveMip() {
   getKktFailures(options_, model_, solution_, basis_, info_);
   // Set the MIP-specific values of info_
   info_.mip_node_count = solver.node_count_;
+  info_.mip_parallel_pruned_node_count = solver.parallel_pruned_node_count_;
   info_.mip_dual_bound = solver.dual_bound_;
   info_.mip_gap = solver.gap_;
   // Get the number of LP iterations, avoiding overflow if the int64_t
@@ -3598,6 +3623,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kSolutionLimit:
+    case HighsModelStatus::kInterrupt:
     case HighsModelStatus::kUnknown:
       assert(return_status == HighsStatus::kWarning);
       break;
@@ -3636,6 +3662,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kSolutionLimit:
+    case HighsModelStatus::kInterrupt:
     case HighsModelStatus::kUnknown:
       // Have info and primal solution (unless infeasible). No primal solution
       // in some other case, too!
@@ -3676,6 +3703,8 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
   // Unapply any modifications that have not yet been unapplied
   this->model_.lp_.unapplyMods();
 
+  recordSchedulerStats();
+
   // Unless solved as a MIP, report on the solution
   const bool solved_as_mip = !options_.solver.compare(kHighsChooseString) &&
                              model_.isMip() && !options_.solve_relaxation;
@@ -3788,6 +3817,9 @@ HighsStatus Highs::crossover(const HighsSolution& user_solution) {
   } else {
     clearSolver();
     solution_ = user_solution;
+    // IPX polls the scheduler for interrupts
+    if (initializeScheduler() != HighsStatus::kOk) return HighsStatus::kError;
+    HighsTaskExecutor::ScopedExecutor scoped_executor(instance_scheduler_);
     // Use IPX crossover to try to form a basic solution
     return_status = callCrossover(options_, model_.lp_, basis_, solution_,
                                   model_status_, info_);
@@ -3808,3 +3840,92 @@ HighsStatus Highs::openLogFile(const std::string& log_file) {
 void Highs::resetGlobalScheduler(bool blocking) {
   HighsTaskExecutor::shutdown(blocking);
 }
+
+// Makes sure that the scheduler used by run() and presolve() is
+// initialized, and sets max_threads. With instance_scheduler, this
+// instance owns a scheduler with the number of threads given by the
+// threads option, recreating it if that option or thread_pinning has
+// changed. Otherwise the global scheduler is used, and an error is
+// returned if it was initialized with a different number of threads
+HighsStatus Highs::initializeScheduler() {
+  if (options_.instance_scheduler) {
+    const int num_threads = options_.threads
+                                ? options_.threads
+                                : highs::parallel::default_num_threads();
+    if (HighsTaskExecutor::getNumWorkerThreads(instance_scheduler_) !=
+            num_threads ||
+        HighsTaskExecutor::getPinThreads(instance_scheduler_) !=
+            options_.thread_pinning) {
+      HighsTaskExecutor::shutdown(instance_scheduler_);
+      HighsTaskExecutor::initialize(instance_scheduler_, num_threads,
+                                    options_.thread_pinning);
+    }
+    max_threads = num_threads;
+    return HighsStatus::kOk;
+  }
+  // Release any scheduler owned by this instance
+  HighsTaskExecutor::shutdown(instance_scheduler_);
+  highs::parallel::initialize_scheduler(options_.threads,
+                                        options_.thread_pinning);
+  max_threads = highs::parallel::num_threads();
+  if (options_.threads != 0 && max_threads != options_.threads) {
+    highsLogUser(
+        options_.log_options, HighsLogType::kError,
+        "Option 'threads' is set to %d but global scheduler has already been "
+        "initialized to use %d threads. The previous scheduler instance can "
+        "be destroyed by calling Highs::resetGlobalScheduler().\n",
+        (int)options_.threads, max_threads);
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
+
+// The scheduler that runs this instance: its own one if instance_scheduler
+// is set, otherwise the global scheduler, whose counters also include the
+// work of any other instance that shares it
+const HighsTaskExecutor::ExecutorHandle& Highs::schedulerHandle() {
+  if (instance_scheduler_.ptr) return instance_scheduler_;
+  return HighsTaskExecutor::getGlobalExecutorHandle();
+}
+
+// Sets the scheduler statistics in info_ to the work done by the
+// scheduler's workers since run() was called, and logs them
+void Highs::recordSchedulerStats() {
+  std::vector<HighsSplitDeque::WorkerStats> worker_stats =
+      HighsTaskExecutor::getWorkerStats(schedulerHandle());
+  info_.scheduler_task_count = 0;
+  info_.scheduler_steal_count = 0;
+  info_.scheduler_failed_steal_count = 0;
+  info_.scheduler_steal_time = 0;
+  info_.scheduler_idle_time = 0;
+  const HighsInt num_worker = worker_stats.size();
+  for (HighsInt iWorker = 0; iWorker < num_worker; iWorker++) {
+    HighsSplitDeque::WorkerStats& stats = worker_stats[iWorker];
+    if (iWorker < (HighsInt)scheduler_stats_.size()) {
+      const HighsSplitDeque::WorkerStats& start = scheduler_stats_[iWorker];
+      stats.numTasksRun -= start.numTasksRun;
+      stats.numSteals -= start.numSteals;
+      stats.numFailedSteals -= start.numFailedSteals;
+      stats.stealTime -= start.stealTime;
+      stats.idleTime -= start.idleTime;
+    }
+    info_.scheduler_task_count += stats.numTasksRun;
+    info_.scheduler_steal_count += stats.numSteals;
+    info_.scheduler_failed_steal_count += stats.numFailedSteals;
+    info_.scheduler_steal_time += stats.stealTime;
+    info_.scheduler_idle_time += stats.idleTime;
+    highsLogDev(options_.log_options, HighsLogType::kDetailed,
+                "Worker %2d: %" PRId64 " tasks; %" PRId64 " steals (%" PRId64
+                " failed); %.3fs stealing; %.3fs idle\n",
+                (int)iWorker, stats.numTasksRun, stats.numSteals,
+                stats.numFailedSteals, stats.stealTime, stats.idleTime);
+  }
+  if (num_worker > 1)
+    highsLogUser(options_.log_options, HighsLogType::kInfo,
+                 "Scheduler: %d workers ran %" PRId64 " tasks; %" PRId64
+                 " steals (%" PRId64 " failed); %.2fs stealing; %.2fs idle\n",
+                 (int)num_worker, info_.scheduler_task_count,
+                 info_.scheduler_steal_count,
+                 info_.scheduler_failed_steal_count, info_.scheduler_steal_time,
+                 info_.scheduler_idle_time);
+}
@@ -30,6 +30,7 @@ void HighsInfo::invalidate() {
   objective_function_value = 0;
   mip_dual_bound = 0;
   mip_gap = kHighsInf;
+  mip_parallel_pruned_node_count = -1;
   max_integrality_violation = kHighsIllegalInfeasibilityMeasure;
   num_primal_infeasibilities = kHighsIllegalInfeasibilityCount;
   max_primal_infeasibility = kHighsIllegalInfeasibilityMeasure;
@@ -37,6 +38,11 @@ void HighsInfo::invalidate() {
   num_dual_infeasibilities = kHighsIllegalInfeasibilityCount;
   max_dual_infeasibility = kHighsIllegalInfeasibilityMeasure;
   sum_dual_infeasibilities = kHighsIllegalInfeasibilityMeasure;
+  scheduler_task_count = 0;
+  scheduler_steal_count = 0;
+  scheduler_failed_steal_count = 0;
+  scheduler_steal_time = 0;
+  scheduler_idle_time = 0;
 }
 
 static std::string infoEntryTypeToString(const HighsInfoType type) {
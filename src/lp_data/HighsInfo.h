@@ -145,6 +145,7 @@ struct HighsInfoStruct {
   double objective_function_value;
   double mip_dual_bound;
   double mip_gap;
+  int64_t mip_parallel_pruned_node_count;
   double max_integrality_violation;
   HighsInt num_primal_infeasibilities;
   double max_primal_infeasibility;
@@ -152,6 +153,11 @@ struct HighsInfoStruct {
   HighsInt num_dual_infeasibilities;
   double max_dual_infeasibility;
   double sum_dual_infeasibilities;
+  int64_t scheduler_task_count;
+  int64_t scheduler_steal_count;
+  int64_t scheduler_failed_steal_count;
+  double scheduler_steal_time;
+  double scheduler_idle_time;
 };
 
 class HighsInfo : public HighsInfoStruct {
@@ -261,6 +267,12 @@ class HighsInfo : public HighsInfoStruct {
                                          advanced, &mip_gap, 0);
     records.push_back(record_double);
 
+    record_int64 = new InfoRecordInt64(
+        "mip_parallel_pruned_node_count",
+        "Number of MIP nodes pruned by parallel LP bounding", advanced,
+        &mip_parallel_pruned_node_count, 0);
+    records.push_back(record_int64);
+
     record_double = new InfoRecordDouble("max_integrality_violation",
                                          "Max integrality violation", advanced,
                                          &max_integrality_violation, 0);
@@ -295,6 +307,37 @@ class HighsInfo : public HighsInfoStruct {
         "sum_dual_infeasibilities", "Sum of dual infeasibilities", advanced,
         &sum_dual_infeasibilities, 0);
     records.push_back(record_double);
+
+    record_int64 = new InfoRecordInt64(
+        "scheduler_task_count",
+        "Number of tasks run by the scheduler's workers", advanced,
+        &scheduler_task_count, 0);
+    records.push_back(record_int64);
+
+    record_int64 = new InfoRecordInt64(
+        "scheduler_steal_count",
+        "Number of tasks stolen by the scheduler's workers", advanced,
+        &scheduler_steal_count, 0);
+    records.push_back(record_int64);
+
+    record_int64 = new InfoRecordInt64(
+        "scheduler_failed_steal_count",
+        "Number of failed attempts to steal a task by the scheduler's workers",
+        advanced, &scheduler_failed_steal_count, 0);
+    records.push_back(record_int64);
+
+    record_double = new InfoRecordDouble(
+        "scheduler_steal_time",
+        "Time (s) spent looking for tasks to steal, summed over the "
+        "scheduler's workers",
+        advanced, &scheduler_steal_time, 0);
+    records.push_back(record_double);
+
+    record_double = new InfoRecordDouble(
+        "scheduler_idle_time",
+        "Time (s) spent waiting for tasks, summed over the scheduler's workers",
+        advanced, &scheduler_idle_time, 0);
+    records.push_back(record_double);
   }
 
  public:
@@ -15,6 +15,7 @@
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
 #include "simplex/HSimplex.h"
+#include "util/HVectorPool.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
 
@@ -1160,9 +1161,8 @@ HighsStatus Highs::basisSolveInterface(const vector<double>& rhs,
   ekk_instance_.setNlaPointersForLpAndScale(lp);
   assert(!lp.is_moved_);
   // Set up solve vector with suitably scaled RHS
-  HVector solve_vector;
-  solve_vector.setup(num_row);
-  solve_vector.clear();
+  PooledHVector pooled_solve_vector(num_row);
+  HVector& solve_vector = *pooled_solve_vector;
   HighsScale& scale = lp.scale_;
   HighsInt rhs_num_nz = 0;
   for (HighsInt iRow = 0; iRow < num_row; iRow++) {
@@ -1448,11 +1448,15 @@ HighsStatus Highs::getPrimalRayInterface(bool& has_primal_ray,
   return return_status;
 }
 
-HighsStatus Highs::getRangingInterface() {
+HighsStatus Highs::getRangingInterface(
+    const std::vector<int8_t>* variable_mask) {
   HighsLpSolverObject solver_object(model_.lp_, basis_, solution_, info_,
                                     ekk_instance_, options_, timer_);
   solver_object.model_status_ = model_status_;
-  return getRangingData(this->ranging_, solver_object);
+  // Ranging shares its work between the workers of the scheduler
+  if (initializeScheduler() != HighsStatus::kOk) return HighsStatus::kError;
+  HighsTaskExecutor::ScopedExecutor scoped_executor(instance_scheduler_);
+  return getRangingData(this->ranging_, solver_object, variable_mask);
 }
 
 bool Highs::aFormatOk(const HighsInt num_nz, const HighsInt format) {
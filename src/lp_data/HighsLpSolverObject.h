@@ -16,6 +16,8 @@
 
 #include "lp_data/HighsInfo.h"
 #include "lp_data/HighsOptions.h"
+#include "parallel/HighsRaceTimer.h"
+#include "parallel/HighsStopToken.h"
 #include "simplex/HEkk.h"
 
 class HighsLpSolverObject {
@@ -40,6 +42,10 @@ class HighsLpSolverObject {
   HighsTimer& timer_;
 
   HighsModelStatus model_status_ = HighsModelStatus::kNotset;
+  // Set when the LP is solved concurrently by several solvers
+  HighsRaceTimer<double>* race_timer_ = nullptr;
+  // Raised when the solve should stop early
+  HighsStopToken stop_token_;
 };
 
 #endif  // LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
@@ -83,13 +83,14 @@ bool commandLineOffOnOk(const HighsLogOptions& report_log_options,
 bool commandLineSolverOk(const HighsLogOptions& report_log_options,
                          const string& value) {
   if (value == kSimplexString || value == kHighsChooseString ||
-      value == kIpmString)
+      value == kIpmString || value == kConcurrentString)
     return true;
-  highsLogUser(
-      report_log_options, HighsLogType::kWarning,
-      "Value \"%s\" for solver option is not one of \"%s\", \"%s\" or \"%s\"\n",
-      value.c_str(), kSimplexString.c_str(), kHighsChooseString.c_str(),
-      kIpmString.c_str());
+  highsLogUser(report_log_options, HighsLogType::kWarning,
+               "Value \"%s\" for solver option is not one of \"%s\", "
+               "\"%s\", \"%s\" or \"%s\"\n",
+               value.c_str(), kSimplexString.c_str(),
+               kHighsChooseString.c_str(), kIpmString.c_str(),
+               kConcurrentString.c_str());
   return false;
 }
 
@@ -362,6 +363,9 @@ OptionStatus checkOptionValue(const HighsLogOptions& report_log_options,
   } else if (option.name == kRunCrossoverString) {
     if (!commandLineOffChooseOnOk(report_log_options, option.name, value))
       return OptionStatus::kIllegalValue;
+  } else if (option.name == kIpmKktSolverString) {
+    if (!commandLineOffChooseOnOk(report_log_options, option.name, value))
+      return OptionStatus::kIllegalValue;
   } else if (option.name == kRangingString) {
     if (!commandLineOffOnOk(report_log_options, option.name, value))
       return OptionStatus::kIllegalValue;
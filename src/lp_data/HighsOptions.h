@@ -257,6 +257,7 @@ void reportOption(FILE* file, const OptionRecordString& option,
 
 const string kSimplexString = "simplex";
 const string kIpmString = "ipm";
+const string kConcurrentString = "concurrent";
 
 const HighsInt kKeepNRowsDeleteRows = -1;
 const HighsInt kKeepNRowsDeleteEntries = 0;
@@ -280,6 +281,9 @@ const string kReadSolutionFileString = "read_solution_file";
 // String for HiGHS log file option
 const string kLogFileString = "log_file";
 
+// String for IPM KKT solver option
+const string kIpmKktSolverString = "ipm_kkt_solver";
+
 struct HighsOptionsStruct {
   // Run-time options read from the command line
   std::string presolve;
@@ -303,6 +307,8 @@ struct HighsOptionsStruct {
   double objective_bound;
   double objective_target;
   HighsInt threads;
+  bool instance_scheduler;
+  bool thread_pinning;
   HighsInt highs_debug_level;
   HighsInt highs_analysis_level;
   HighsInt simplex_strategy;
@@ -314,6 +320,9 @@ struct HighsOptionsStruct {
   HighsInt simplex_update_limit;
   HighsInt simplex_min_concurrency;
   HighsInt simplex_max_concurrency;
+  bool simplex_parallel_price;
+  bool simplex_parallel_tran;
+  HighsInt simplex_factor_cache_size;
 
   std::string log_file;
   bool write_model_to_file;
@@ -327,6 +336,7 @@ struct HighsOptionsStruct {
 
   // Options for IPM solver
   HighsInt ipm_iteration_limit;
+  std::string ipm_kkt_solver;
 
   // Advanced options
   HighsInt log_dev_level;
@@ -340,6 +350,8 @@ struct HighsOptionsStruct {
   HighsInt allowed_matrix_scale_factor;
   HighsInt allowed_cost_scale_factor;
   HighsInt ipx_dualize_strategy;
+  bool ipx_warm_start;
+  double ipx_warm_start_mu;
   HighsInt simplex_dualize_strategy;
   HighsInt simplex_permute_strategy;
   HighsInt max_dual_simplex_cleanup_level;
@@ -379,6 +391,7 @@ struct HighsOptionsStruct {
 
   // Options for MIP solver
   bool mip_detect_symmetry;
+  bool mip_parallel_search;
   HighsInt mip_max_nodes;
   HighsInt mip_max_stall_nodes;
   HighsInt mip_max_leaves;
@@ -470,9 +483,11 @@ class HighsOptions : public HighsOptionsStruct {
 
     record_string = new OptionRecordString(
         kSolverString,
-        "Solver option: \"simplex\", \"choose\" or \"ipm\". If "
-        "\"simplex\"/\"ipm\" is chosen then, for a MIP (QP) the integrality "
-        "constraint (quadratic term) will be ignored",
+        "Solver option: \"simplex\", \"choose\", \"ipm\" or \"concurrent\". "
+        "If \"simplex\"/\"ipm\"/\"concurrent\" is chosen then, for a MIP "
+        "(QP) the integrality constraint (quadratic term) will be ignored. "
+        "With \"concurrent\", dual simplex, primal simplex and IPM are run "
+        "in parallel and the first to finish is used",
         advanced, &solver, kHighsChooseString);
     records.push_back(record_string);
 
@@ -562,6 +577,25 @@ class HighsOptions : public HighsOptionsStruct {
         &threads, 0, 0, kHighsIInf);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "instance_scheduler",
+        "Whether this Highs instance uses its own scheduler, with the number "
+        "of threads given by the threads option, rather than the global "
+        "scheduler. This allows Highs instances to solve concurrently",
+        advanced, &instance_scheduler, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "thread_pinning",
+        "Whether the scheduler's worker threads are pinned to CPUs when the "
+        "scheduler is created. Workers then allocate their task deques on "
+        "their own NUMA node and prefer to steal tasks from workers on the "
+        "same node. The calling thread, which acts as the first worker, is "
+        "not pinned and is taken to be on the node where it runs when the "
+        "scheduler is created",
+        advanced, &thread_pinning, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt("highs_debug_level",
                                      "Debugging level in HiGHS", now_advanced,
                                      &highs_debug_level, kHighsDebugLevelMin,
@@ -643,6 +677,28 @@ class HighsOptions : public HighsOptionsStruct {
                             kSimplexConcurrencyLimit, kSimplexConcurrencyLimit);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "simplex_parallel_price",
+        "Whether serial dual simplex performs PRICE in parallel over slices "
+        "of the matrix. The iterations are unchanged",
+        advanced, &simplex_parallel_price, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "simplex_parallel_tran",
+        "Whether dense FTRAN and BTRAN are performed in parallel over levels "
+        "of the LU factors. Rounding may differ from the serial solves",
+        advanced, &simplex_parallel_tran, false);
+    records.push_back(record_bool);
+
+    record_int = new OptionRecordInt(
+        "simplex_factor_cache_size",
+        "Number of factorizations of bases at the end of simplex solves that "
+        "are retained so that a solve starting from one of them avoids "
+        "INVERT. Zero disables the cache",
+        advanced, &simplex_factor_cache_size, 0, 0, kHighsIInf);
+    records.push_back(record_int);
+
     record_bool =
         new OptionRecordBool("output_flag", "Enables or disables solver output",
                              advanced, &output_flag, true);
@@ -743,6 +799,13 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &mip_detect_symmetry, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "mip_parallel_search",
+        "Whether the LP relaxations of open MIP nodes are solved in parallel "
+        "batches before the nodes are searched",
+        advanced, &mip_parallel_search, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt("mip_max_nodes",
                                      "MIP solver max number of nodes", advanced,
                                      &mip_max_nodes, 0, kHighsIInf, kHighsIInf);
@@ -862,6 +925,14 @@ class HighsOptions : public HighsOptionsStruct {
         &ipm_iteration_limit, 0, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
 
+    record_string = new OptionRecordString(
+        kIpmKktSolverString,
+        "IPM KKT solver: \"off\" for the preconditioned iterative solvers, "
+        "\"on\" for a Cholesky factorization of the normal matrix, or "
+        "\"choose\" for the Cholesky factorization when its fill is small",
+        advanced, &ipm_kkt_solver, kHighsOffString);
+    records.push_back(record_string);
+
     // Fix the number of user settable options
     num_user_settable_options_ = records.size();
 
@@ -937,6 +1008,20 @@ class HighsOptions : public HighsOptionsStruct {
         kIpxDualizeStrategyMax);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "ipx_warm_start",
+        "Start IPX from the solution and basis of the previous solve of a "
+        "modified LP, when available",
+        advanced, &ipx_warm_start, false);
+    records.push_back(record_bool);
+
+    record_double = new OptionRecordDouble(
+        "ipx_warm_start_mu",
+        "Lower bound on the complementarity products of a warm start point "
+        "for IPX",
+        advanced, &ipx_warm_start_mu, 0, 1e-4, kHighsInf);
+    records.push_back(record_double);
+
     record_int = new OptionRecordInt(
         "simplex_dualize_strategy", "Strategy for dualizing before simplex",
         advanced, &simplex_dualize_strategy, kHighsOptionOff, kHighsOptionOff,
@@ -19,6 +19,8 @@
 #include <sstream>
 
 #include "lp_data/HighsModelUtils.h"
+#include "parallel/HighsParallel.h"
+#include "util/HVectorPool.h"
 
 using std::min;
 
@@ -70,8 +72,82 @@ static double possInfProduct(double poss_inf, double value) {
   }
 }
 
+// Number of variables or rows in each block of ranging work shared
+// between the workers of the task executor
+const HighsInt kRangingBlockSize = 32;
+
+// Results of the accumulated dual ratio test for each row
+struct RangingDualRatioTest {
+  std::vector<double> tci_inc;    // theta
+  std::vector<double> aci_inc;    // alpha
+  std::vector<HighsInt> jci_inc;  // column index
+  std::vector<double> tci_dec;
+  std::vector<double> aci_dec;
+  std::vector<HighsInt> jci_dec;
+
+  void setup(const HighsInt num_row, const double theta_inf) {
+    tci_inc.assign(num_row, +theta_inf);
+    aci_inc.assign(num_row, 0);
+    jci_inc.assign(num_row, -1);
+    tci_dec.assign(num_row, -theta_inf);
+    aci_dec.assign(num_row, 0);
+    jci_dec.assign(num_row, -1);
+  }
+
+  // Apply the test to the entry alpha of variable j in row i. Ties
+  // are broken in favour of the lower variable index, so the result
+  // is that of applying the test to the variables in order,
+  // whatever order they are actually applied in
+  void update(const HighsInt i, const HighsInt j, const double alpha,
+              const double d_inc, const double d_dec) {
+    const double theta_inc = (alpha < 0 ? d_inc : d_dec) / -alpha;
+    const double theta_dec = (alpha > 0 ? d_inc : d_dec) / -alpha;
+    if (tci_inc[i] > theta_inc || (tci_inc[i] == theta_inc && j < jci_inc[i]))
+      tci_inc[i] = theta_inc, aci_inc[i] = alpha, jci_inc[i] = j;
+    if (tci_dec[i] < theta_dec || (tci_dec[i] == theta_dec && j < jci_dec[i]))
+      tci_dec[i] = theta_dec, aci_dec[i] = alpha, jci_dec[i] = j;
+  }
+
+  // Merge the results of a test applied to a different set of
+  // variables
+  void merge(const RangingDualRatioTest& other) {
+    const HighsInt num_row = tci_inc.size();
+    for (HighsInt i = 0; i < num_row; i++) {
+      const HighsInt j_inc = other.jci_inc[i];
+      if (j_inc != -1 &&
+          (tci_inc[i] > other.tci_inc[i] ||
+           (tci_inc[i] == other.tci_inc[i] && j_inc < jci_inc[i]))) {
+        tci_inc[i] = other.tci_inc[i];
+        aci_inc[i] = other.aci_inc[i];
+        jci_inc[i] = j_inc;
+      }
+      const HighsInt j_dec = other.jci_dec[i];
+      if (j_dec != -1 &&
+          (tci_dec[i] < other.tci_dec[i] ||
+           (tci_dec[i] == other.tci_dec[i] && j_dec < jci_dec[i]))) {
+        tci_dec[i] = other.tci_dec[i];
+        aci_dec[i] = other.aci_dec[i];
+        jci_dec[i] = j_dec;
+      }
+    }
+  }
+};
+
+// The number of workers that can perform the tasks created by
+// for_each_block, and the worker performing the current task
+static HighsInt rangingNumWorker() {
+  if (!HighsTaskExecutor::getThisWorkerDeque()) return 1;
+  return highs::parallel::num_threads();
+}
+
+static HighsInt rangingWorker() {
+  if (!HighsTaskExecutor::getThisWorkerDeque()) return 0;
+  return highs::parallel::thread_num();
+}
+
 HighsStatus getRangingData(HighsRanging& ranging,
-                           HighsLpSolverObject& solver_object) {
+                           HighsLpSolverObject& solver_object,
+                           const std::vector<int8_t>* variable_mask) {
   ranging.clear();
   if (solver_object.model_status_ != HighsModelStatus::kOptimal) {
     highsLogUser(solver_object.options_.log_options, HighsLogType::kError,
@@ -125,11 +201,6 @@ HighsStatus getRangingData(HighsRanging& ranging,
   HighsInt sense = 1;
   if (use_lp.sense_ == ObjSense::kMaximize) sense = -1;
 
-  vector<HighsInt> iWork_(numTotal);
-  vector<double> dWork_(numTotal);
-  HVector column;
-  column.setup(numRow);
-
   vector<double> xi = Bvalue_;
   for (HighsInt i = 0; i < numRow; i++) {
     xi[i] = max(xi[i], Blower_[i]);
@@ -180,81 +251,176 @@ HighsStatus getRangingData(HighsRanging& ranging,
   vector<HighsInt> wxj_dec(numTotal, 0);
   vector<HighsInt> jxj_dec(numTotal, -1);
 
-  vector<double> tci_inc(numRow, +THETA_INF);  // theta
-  vector<double> aci_inc(numRow, 0);           // alpha
-  vector<HighsInt> jci_inc(numRow, -1);        // column index
-
-  vector<double> tci_dec(numRow, -THETA_INF);
-  vector<double> aci_dec(numRow, 0);
-  vector<HighsInt> jci_dec(numRow, -1);
-
-  // Major "theta" loop
-  for (HighsInt j = 0; j < numTotal; j++) {
-    // Skip basic column
-    if (!Nflag_[j]) continue;
-
-    // Form updated column
+  RangingDualRatioTest dual_ratio_test;
+  dual_ratio_test.setup(numRow, THETA_INF);
+  const vector<double>& tci_inc = dual_ratio_test.tci_inc;
+  const vector<double>& aci_inc = dual_ratio_test.aci_inc;
+  const vector<HighsInt>& jci_inc = dual_ratio_test.jci_inc;
+  const vector<double>& tci_dec = dual_ratio_test.tci_dec;
+  const vector<double>& aci_dec = dual_ratio_test.aci_dec;
+  const vector<HighsInt>& jci_dec = dual_ratio_test.jci_dec;
+
+  // Form the updated column of nonbasic variable j and perform the
+  // standard primal ratio test. This only writes entries j of the
+  // "theta" space, so can be done for different j concurrently
+  const double expected_density = ekk_instance.info_.col_aq_density;
+  auto primalRatioTest = [&](const HighsInt j, HVector& column) {
     column.clear();
     matrix.collectAj(column, j, 1);
-
-    const double expected_density = ekk_instance.info_.col_aq_density;
     ekk_instance.ftran(column, expected_density);
-    HighsInt nWork = 0;
+    double myt_inc = +THETA_INF;
+    double myt_dec = -THETA_INF;
+    HighsInt myi_inc = -1;
+    HighsInt myi_dec = -1;
     for (HighsInt k = 0; k < column.count; k++) {
-      HighsInt iRow = column.index[k];
-      double alpha = column.array[iRow];
+      HighsInt i = column.index[k];
+      double alpha = column.array[i];
       if (fabs(alpha) > tol_a) {
-        iWork_[nWork] = iRow;
-        dWork_[nWork] = alpha;
-        nWork++;
+        double theta_inc = (alpha < 0 ? dxi_inc[i] : dxi_dec[i]) / -alpha;
+        double theta_dec = (alpha > 0 ? dxi_inc[i] : dxi_dec[i]) / -alpha;
+        if (myt_inc > theta_inc) myt_inc = theta_inc, myi_inc = i;
+        if (myt_dec < theta_dec) myt_dec = theta_dec, myi_dec = i;
       }
     }
-    // Standard primal ratio test
-    double myt_inc = +THETA_INF;
-    double myt_dec = -THETA_INF;
-    HighsInt myk_inc = -1;
-    HighsInt myk_dec = -1;
-    for (HighsInt k = 0; k < nWork; k++) {
-      HighsInt i = iWork_[k];
-      double alpha = dWork_[k];
-      double theta_inc = (alpha < 0 ? dxi_inc[i] : dxi_dec[i]) / -alpha;
-      double theta_dec = (alpha > 0 ? dxi_inc[i] : dxi_dec[i]) / -alpha;
-      if (myt_inc > theta_inc) myt_inc = theta_inc, myk_inc = k;
-      if (myt_dec < theta_dec) myt_dec = theta_dec, myk_dec = k;
-    }
 
-    if (myk_inc != -1) {
-      HighsInt i = iWork_[myk_inc];
-      double alpha = dWork_[myk_inc];
+    if (myi_inc != -1) {
+      HighsInt i = myi_inc;
+      double alpha = column.array[i];
       ixj_inc[j] = i;
       axj_inc[j] = alpha;
-      const double numerator = (alpha < 0 ? dxi_inc[i] : dxi_dec[i]);
       txj_inc[j] = (alpha < 0 ? dxi_inc[i] : dxi_dec[i]) / -alpha;
       wxj_inc[j] = (alpha < 0 ? +1 : -1);
     }
 
-    if (myk_dec != -1) {
-      HighsInt i = iWork_[myk_dec];
-      double alpha = dWork_[myk_dec];
+    if (myi_dec != -1) {
+      HighsInt i = myi_dec;
+      double alpha = column.array[i];
       ixj_dec[j] = i;
       axj_dec[j] = alpha;
       txj_dec[j] = (alpha > 0 ? dxi_inc[i] : dxi_dec[i]) / -alpha;
       wxj_dec[j] = (alpha > 0 ? +1 : -1);
     }
-
-    // Accumulated dual ratio test
-    double myd_inc = ddj_inc[j];
-    double myd_dec = ddj_dec[j];
-    for (HighsInt k = 0; k < nWork; k++) {
-      HighsInt i = iWork_[k];
-      double alpha = dWork_[k];
-      double theta_inc = (alpha < 0 ? myd_inc : myd_dec) / -alpha;
-      double theta_dec = (alpha > 0 ? myd_inc : myd_dec) / -alpha;
-      if (tci_inc[i] > theta_inc)
-        tci_inc[i] = theta_inc, aci_inc[i] = alpha, jci_inc[i] = j;
-      if (tci_dec[i] < theta_dec)
-        tci_dec[i] = theta_dec, aci_dec[i] = alpha, jci_dec[i] = j;
+  };
+
+  // Form the updated columns of the nonbasic variables in var_set in
+  // blocks shared between the workers, each using its own column
+  // buffer
+  auto primalRatioTests = [&](const std::vector<HighsInt>& var_set) {
+    highs::parallel::for_each_block(
+        0, (HighsInt)var_set.size(),
+        [&](HighsInt from_k, HighsInt to_k) {
+          PooledHVector pooled_column(numRow);
+          for (HighsInt k = from_k; k < to_k; k++)
+            primalRatioTest(var_set[k], *pooled_column);
+        },
+        kRangingBlockSize);
+  };
+
+  auto required = [&](const HighsInt j) {
+    return !variable_mask || (*variable_mask)[j];
+  };
+  const HighsInt num_worker = rangingNumWorker();
+  if (!variable_mask) {
+    // Major "theta" loop. Each worker accumulates the dual ratio test
+    // for the updated columns that it forms, and the results are
+    // then merged
+    std::vector<RangingDualRatioTest> worker_dual_ratio_test(num_worker - 1);
+    for (RangingDualRatioTest& worker_test : worker_dual_ratio_test)
+      worker_test.setup(numRow, THETA_INF);
+    highs::parallel::for_each_block(
+        0, numTotal,
+        [&](HighsInt from_j, HighsInt to_j) {
+          const HighsInt worker = rangingWorker();
+          RangingDualRatioTest& local_test =
+              worker ? worker_dual_ratio_test[worker - 1] : dual_ratio_test;
+          PooledHVector pooled_column(numRow);
+          HVector& column = *pooled_column;
+          for (HighsInt j = from_j; j < to_j; j++) {
+            // Skip basic column
+            if (!Nflag_[j]) continue;
+            primalRatioTest(j, column);
+            // Accumulated dual ratio test
+            for (HighsInt k = 0; k < column.count; k++) {
+              HighsInt i = column.index[k];
+              double alpha = column.array[i];
+              if (fabs(alpha) > tol_a)
+                local_test.update(i, j, alpha, ddj_inc[j], ddj_dec[j]);
+            }
+          }
+        },
+        kRangingBlockSize);
+    for (const RangingDualRatioTest& worker_test : worker_dual_ratio_test)
+      dual_ratio_test.merge(worker_test);
+  } else {
+    // Ranging is only required for the variables in the mask, so
+    // only form the updated columns of those that are nonbasic
+    std::vector<int8_t> have_column(numTotal, 0);
+    std::vector<HighsInt> var_set;
+    for (HighsInt j = 0; j < numTotal; j++) {
+      if (Nflag_[j] && (*variable_mask)[j]) {
+        have_column[j] = 1;
+        var_set.push_back(j);
+      }
     }
+    primalRatioTests(var_set);
+
+    // The dual ratio test is required for the rows of basic variables
+    // in the mask, and the rows that limit the primal ratio test for
+    // nonbasic variables in the mask. Rather than accumulate it over
+    // all updated columns, it is performed for each such row using
+    // the row of the tableau. The rows are independent, so are shared
+    // between the workers
+    std::vector<int8_t> need_row(numRow, 0);
+    for (HighsInt i = 0; i < numRow; i++)
+      if ((*variable_mask)[Bindex_[i]]) need_row[i] = 1;
+    for (const HighsInt j : var_set) {
+      if (ixj_inc[j] != -1) need_row[ixj_inc[j]] = 1;
+      if (ixj_dec[j] != -1) need_row[ixj_dec[j]] = 1;
+    }
+    std::vector<HighsInt> row_set;
+    for (HighsInt i = 0; i < numRow; i++)
+      if (need_row[i]) row_set.push_back(i);
+    highs::parallel::for_each_block(
+        0, (HighsInt)row_set.size(),
+        [&](HighsInt from_k, HighsInt to_k) {
+          PooledHVector pooled_row_ep(numRow);
+          PooledHVector pooled_row_ap(numCol);
+          HVector& row_ep = *pooled_row_ep;
+          HVector& row_ap = *pooled_row_ap;
+          for (HighsInt k = from_k; k < to_k; k++) {
+            const HighsInt i = row_set[k];
+            row_ep.clear();
+            row_ep.count = 1;
+            row_ep.index[0] = i;
+            row_ep.array[i] = 1;
+            row_ep.packFlag = false;
+            ekk_instance.btran(row_ep, ekk_instance.info_.row_ep_density);
+            const bool quad_precision = false;
+            row_ap.clear();
+            matrix.priceByColumn(quad_precision, row_ap, row_ep);
+            for (HighsInt j = 0; j < numTotal; j++) {
+              if (!Nflag_[j]) continue;
+              double alpha =
+                  j < numCol ? row_ap.array[j] : row_ep.array[j - numCol];
+              if (fabs(alpha) > tol_a)
+                dual_ratio_test.update(i, j, alpha, ddj_inc[j], ddj_dec[j]);
+            }
+          }
+        },
+        kRangingBlockSize);
+
+    // Ranging for basic variables in the mask also requires the
+    // primal ratio test for the variables that would enter the basis
+    var_set.clear();
+    for (HighsInt i = 0; i < numRow; i++) {
+      if (!(*variable_mask)[Bindex_[i]]) continue;
+      for (const HighsInt j : {jci_inc[i], jci_dec[i]}) {
+        if (j == -1 || have_column[j]) continue;
+        have_column[j] = 1;
+        var_set.push_back(j);
+      }
+    }
+    primalRatioTests(var_set);
   }
 
   // Additional j-out for primal ratio test (considering bound flip)
@@ -299,7 +465,7 @@ HighsStatus getRangingData(HighsRanging& ranging,
   //
   //  const HighsInt check_col = 2951;
   for (HighsInt j = 0; j < numCol; j++) {
-    if (Nflag_[j]) {
+    if (Nflag_[j] && required(j)) {
       // Primal value and its sign
       double value = value_[j];
       double vsign = (value > 0) ? 1 : (value < 0 ? -1 : 0);
@@ -341,7 +507,7 @@ HighsStatus getRangingData(HighsRanging& ranging,
   //
 
   for (HighsInt i = 0; i < numRow; i++) {
-    if (Bindex_[i] < numCol) {
+    if (Bindex_[i] < numCol && required(Bindex_[i])) {
       // Primal variable and its sign
       HighsInt j = Bindex_[i], je;
       double value = xi[i];
@@ -391,7 +557,7 @@ HighsStatus getRangingData(HighsRanging& ranging,
   // Ranging 3.1. nonbasic bounds ranging
   //
   for (HighsInt j = 0; j < numTotal; j++) {
-    if (Nflag_[j]) {
+    if (Nflag_[j] && required(j)) {
       // FREE variable
       if (lower_[j] == -H_INF && upper_[j] == H_INF) {
         b_up_b[j] = H_INF;
@@ -465,6 +631,7 @@ HighsStatus getRangingData(HighsRanging& ranging,
   // Ranging 3.2. basic bounds ranging
   //
   for (HighsInt i = 0; i < numRow; i++) {
+    if (!required(Bindex_[i])) continue;
     for (HighsInt dir = -1; dir <= 1; dir += 2) {
       HighsInt j = Bindex_[i];
       double& newx = dir == -1 ? b_dn_b[j] : b_up_b[j];
@@ -531,6 +698,13 @@ HighsStatus getRangingData(HighsRanging& ranging,
     if (fabs(b_dn_b[j]) < H_TT) b_dn_b[j] = 0;
   }
 
+  // Indicate that there is no ranging for variables not in the mask
+  for (HighsInt j = 0; j < numTotal; j++) {
+    if (required(j)) continue;
+    c_up_e[j] = c_dn_e[j] = c_up_l[j] = c_dn_l[j] = -1;
+    b_up_e[j] = b_dn_e[j] = b_up_l[j] = b_dn_l[j] = -1;
+  }
+
   //
   // Ranging 4.2. Put to output buffer
   //
@@ -37,8 +37,11 @@ struct HighsRanging {
   void clear();
 };
 
-HighsStatus getRangingData(HighsRanging& ranging,
-                           HighsLpSolverObject& solver_object);
+// Ranging is computed for the variables in variable_mask or, if it
+// is nullptr, for all variables
+HighsStatus getRangingData(
+    HighsRanging& ranging, HighsLpSolverObject& solver_object,
+    const std::vector<int8_t>* variable_mask = nullptr);
 void writeRangingFile(FILE* file, const HighsLp& lp,
                       const double objective_function_value,
                       const HighsBasis& basis, const HighsSolution& solution,
@@ -1270,9 +1270,13 @@ void accommodateAlienBasis(HighsLpSolverObject& solver_object) {
   }
   HighsInt num_basic_variables = basic_index.size();
   HFactor factor;
-  factor.setupGeneral(&lp.a_matrix_, num_basic_variables, basic_index.data(),
-                      kDefaultPivotThreshold, kDefaultPivotTolerance,
-                      kHighsDebugLevelMin, &options.log_options);
+  // If the basis matrix is too large to be factored, leave the basis
+  // unchanged for the simplex solver to fail cleanly
+  if (factor.setupGeneral(&lp.a_matrix_, num_basic_variables,
+                          basic_index.data(), kDefaultPivotThreshold,
+                          kDefaultPivotTolerance, kHighsDebugLevelMin,
+                          &options.log_options))
+    return;
   HighsInt rank_deficiency = factor.build();
   // Must not have timed out
   assert(rank_deficiency >= 0);
@@ -12,8 +12,12 @@
  * @brief Class-independent utilities for HiGHS
  */
 
+#include <atomic>
+#include <memory>
+
 #include "ipm/IpxWrapper.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HApp.h"
 
 // The method below runs simplex or ipx solver on the lp.
@@ -43,6 +47,12 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
     return_status = interpretCallStatus(options.log_options, call_status,
                                         return_status, "solveUnconstrainedLp");
     if (return_status == HighsStatus::kError) return return_status;
+  } else if (options.solver == kConcurrentString) {
+    // Race dual simplex, primal simplex and IPX
+    call_status = solveLpConcurrent(solver_object);
+    return_status = interpretCallStatus(options.log_options, call_status,
+                                        return_status, "solveLpConcurrent");
+    if (return_status == HighsStatus::kError) return return_status;
   } else if (options.solver == kIpmString) {
     // Use IPM
     bool imprecise_solution;
@@ -124,6 +134,122 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
   return return_status;
 }
 
+// Data for one of the solvers racing in solveLpConcurrent. Everything
+// that solveLp modifies is copied, so the racers are independent
+struct HighsLpRacer {
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsInfo highs_info;
+  HEkk ekk_instance;
+  HighsOptions options;
+  HighsTimer timer;
+  HighsLpSolverObject solver_object;
+  HighsStatus return_status = HighsStatus::kError;
+
+  HighsLpRacer(const HighsLpSolverObject& incumbent,
+               HighsRaceTimer<double>& race_timer)
+      : lp(incumbent.lp_),
+        basis(incumbent.basis_),
+        highs_info(incumbent.highs_info_),
+        options(incumbent.options_),
+        solver_object(lp, basis, solution, highs_info, ekk_instance, options,
+                      timer) {
+    solver_object.race_timer_ = &race_timer;
+    solver_object.stop_token_ = incumbent.stop_token_;
+  }
+};
+
+// Whether a racer has concluded the solve, rather than stopping at a
+// limit or failing
+static bool raceWon(const HighsLpRacer& racer) {
+  if (racer.return_status == HighsStatus::kError) return false;
+  switch (racer.solver_object.model_status_) {
+    case HighsModelStatus::kOptimal:
+    case HighsModelStatus::kInfeasible:
+    case HighsModelStatus::kUnbounded:
+    case HighsModelStatus::kObjectiveBound:
+    case HighsModelStatus::kObjectiveTarget:
+      return true;
+    case HighsModelStatus::kUnboundedOrInfeasible:
+      return racer.options.allow_unbounded_or_infeasible;
+    default:
+      return false;
+  }
+}
+
+// Solves the LP with dual simplex, primal simplex and IPX in
+// parallel. The first to conclude the solve sets the limit of the
+// race timer, so the others stop, and its solution, basis and info
+// are returned. If none concludes, the dual simplex result is
+// returned
+HighsStatus solveLpConcurrent(HighsLpSolverObject& solver_object) {
+  HighsOptions& options = solver_object.options_;
+  const HighsInt kNumRacer = 3;
+  const std::string racer_name[kNumRacer] = {"dual simplex", "primal simplex",
+                                             "IPX"};
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Solving LP concurrently with %s, %s and %s\n",
+               racer_name[0].c_str(), racer_name[1].c_str(),
+               racer_name[2].c_str());
+  const double time_left =
+      options.time_limit - solver_object.timer_.readRunHighsClock();
+  HighsRaceTimer<double> race_timer;
+  std::vector<std::unique_ptr<HighsLpRacer>> racers;
+  for (HighsInt iRacer = 0; iRacer < kNumRacer; iRacer++) {
+    racers.emplace_back(new HighsLpRacer(solver_object, race_timer));
+    HighsOptions& racer_options = racers.back()->options;
+    // Logging from the racers would be interleaved, so suppress it
+    racer_options.output_flag = false;
+    racer_options.time_limit = time_left;
+    racer_options.solver = iRacer < 2 ? kSimplexString : kIpmString;
+  }
+  racers[0]->options.simplex_strategy = kSimplexStrategyDual;
+  racers[1]->options.simplex_strategy = kSimplexStrategyPrimal;
+  // Start all the racers' clocks together so that their times are
+  // comparable with the race timer limit, even if a racer's task
+  // starts late
+  for (auto& racer : racers) racer->timer.startRunHighsClock();
+
+  std::atomic<HighsInt> winner{-1};
+  auto race = [&](HighsInt iRacer) {
+    HighsLpRacer& racer = *racers[iRacer];
+    racer.return_status =
+        solveLp(racer.solver_object, "Solving LP with " + racer_name[iRacer]);
+    if (!raceWon(racer)) return;
+    HighsInt no_winner = -1;
+    if (winner.compare_exchange_strong(no_winner, iRacer))
+      race_timer.decreaseLimit(racer.timer.readRunHighsClock());
+  };
+
+  {
+    highs::parallel::TaskGroup tg;
+    for (HighsInt iRacer = 1; iRacer < kNumRacer; iRacer++)
+      tg.spawn([&race, iRacer]() { race(iRacer); });
+    race(0);
+    // Racers that have not started need not be run
+    if (winner.load() >= 0) tg.cancel();
+    tg.taskWait();
+  }
+
+  HighsInt iWinner = winner.load();
+  if (iWinner >= 0) {
+    highsLogUser(options.log_options, HighsLogType::kInfo,
+                 "Concurrent LP solve won by %s\n",
+                 racer_name[iWinner].c_str());
+  } else {
+    iWinner = 0;
+  }
+  HighsLpRacer& result = *racers[iWinner];
+  solver_object.model_status_ = result.solver_object.model_status_;
+  solver_object.basis_ = result.basis;
+  solver_object.solution_ = result.solution;
+  solver_object.highs_info_ = result.highs_info;
+  // The incumbent simplex instance holds no data for this solution
+  solver_object.ekk_instance_.invalidate();
+  return result.return_status;
+}
+
 // Solves an unconstrained LP without scaling, setting HighsBasis, HighsSolution
 // and HighsInfo
 HighsStatus solveUnconstrainedLp(HighsLpSolverObject& solver_object) {
@@ -1283,6 +1283,10 @@ void HighsCliqueTable::extractCliques(HighsMipSolver& mipsolver,
         mipsolver.orig_model_->num_row_)
       break;
 
+    // the cliques found so far are valid, so stop extracting when the solve
+    // is interrupted or runs out of time
+    if (mipsolver.mipdata_->stopSource.stopRequested()) break;
+
     // catch set packing and partitioning constraints that already have the form
     // of a clique without transformations and add those cliques with the rows
     // being recorded
@@ -20,6 +20,9 @@
 #include "mip/HighsMipSolverData.h"
 #include "pdqsort/pdqsort.h"
 
+// number of rows whose activities are recomputed by one task
+static constexpr HighsInt kRowActivityGrainSize = 256;
+
 static double activityContributionMin(double coef, const double& lb,
                                       const double& ub) {
   if (coef < 0) {
@@ -1988,19 +1991,28 @@ void HighsDomain::computeRowActivities() {
   propagateflags_.resize(mipsolver->numRow());
   propagateinds_.reserve(mipsolver->numRow());
 
-  for (HighsInt i = 0; i != mipsolver->numRow(); ++i) {
-    HighsInt start = mipsolver->mipdata_->ARstart_[i];
-    HighsInt end = mipsolver->mipdata_->ARstart_[i + 1];
+  // the activities of different rows are independent, so they are computed in
+  // parallel, whereas rows are marked for propagation in order below
+  highs::parallel::for_each_block(
+      0, mipsolver->numRow(),
+      [&](HighsInt blockStart, HighsInt blockEnd) {
+        for (HighsInt i = blockStart; i != blockEnd; ++i) {
+          HighsInt start = mipsolver->mipdata_->ARstart_[i];
+          HighsInt end = mipsolver->mipdata_->ARstart_[i + 1];
 
-    computeMinActivity(start, end, mipsolver->mipdata_->ARindex_.data(),
-                       mipsolver->mipdata_->ARvalue_.data(), activitymininf_[i],
-                       activitymin_[i]);
-    computeMaxActivity(start, end, mipsolver->mipdata_->ARindex_.data(),
-                       mipsolver->mipdata_->ARvalue_.data(), activitymaxinf_[i],
-                       activitymax_[i]);
+          computeMinActivity(start, end, mipsolver->mipdata_->ARindex_.data(),
+                             mipsolver->mipdata_->ARvalue_.data(),
+                             activitymininf_[i], activitymin_[i]);
+          computeMaxActivity(start, end, mipsolver->mipdata_->ARindex_.data(),
+                             mipsolver->mipdata_->ARvalue_.data(),
+                             activitymaxinf_[i], activitymax_[i]);
 
-    recomputeCapacityThreshold(i);
+          recomputeCapacityThreshold(i);
+        }
+      },
+      kRowActivityGrainSize);
 
+  for (HighsInt i = 0; i != mipsolver->numRow(); ++i) {
     if ((activitymininf_[i] <= 1 && mipsolver->rowUpper(i) != kHighsInf) ||
         (activitymaxinf_[i] <= 1 && mipsolver->rowLower(i) != -kHighsInf)) {
       markPropagate(i);
@@ -17,6 +17,7 @@
 #include "mip/HighsMipSolver.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsPseudocost.h"
+#include "util/HVectorPool.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsHash.h"
 
@@ -110,6 +111,9 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsMipSolver& mipsolver)
   lpsolver.setOptionValue(
       "dual_feasibility_tolerance",
       mipsolver.options_mip_->mip_feasibility_tolerance * 0.1);
+  // The LP is modified between most solves, so caching factorizations
+  // at the end of each solve would only cost copies
+  lpsolver.setOptionValue("simplex_factor_cache_size", 0);
   status = Status::kNotSet;
   numlpiters = 0;
   avgSolveIters = 0;
@@ -120,7 +124,6 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsMipSolver& mipsolver)
   objective = -kHighsInf;
   currentbasisstored = false;
   adjustSymBranchingCol = true;
-  row_ep.size = 0;
 }
 
 HighsLpRelaxation::HighsLpRelaxation(const HighsLpRelaxation& other)
@@ -145,7 +148,6 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsLpRelaxation& other)
   maxNumFractional = 0;
   lastAgeCall = 0;
   objective = -kHighsInf;
-  row_ep.size = 0;
 }
 
 void HighsLpRelaxation::loadModel() {
@@ -203,14 +205,12 @@ void HighsLpRelaxation::computeBasicDegenerateDuals(double threshold,
   const HighsInt num_row = lp.num_row_;
   const HighsInt num_col = lp.num_col_;
 
-  if (row_ep.size < num_row) {
-    row_ep.setup(num_row);
-
-    if ((HighsInt)row_ap.values.size() < num_col) {
-      row_ap.setDimension(num_col);
-      dualproofvals.reserve(num_col);
-      dualproofinds.reserve(num_col);
-    }
+  PooledHVector pooled_row_ep(num_row);
+  HVector& row_ep = *pooled_row_ep;
+  if ((HighsInt)row_ap.values.size() < num_col) {
+    row_ap.setDimension(num_col);
+    dualproofvals.reserve(num_col);
+    dualproofinds.reserve(num_col);
   }
 
   const HighsInt* basicIndex = lpsolver.getBasicVariablesArray();
@@ -799,14 +799,12 @@ void HighsLpRelaxation::storeDualInfProof() {
   HighsInt num_row = lpsolver.getNumRow();
   HighsInt num_col = lpsolver.getNumCol();
 
-  if (row_ep.size < num_row) {
-    row_ep.setup(num_row);
-
-    if ((HighsInt)row_ap.values.size() < num_col) {
-      row_ap.setDimension(num_col);
-      dualproofvals.reserve(num_col);
-      dualproofinds.reserve(num_col);
-    }
+  PooledHVector pooled_row_ep(num_row);
+  HVector& row_ep = *pooled_row_ep;
+  if ((HighsInt)row_ap.values.size() < num_col) {
+    row_ap.setDimension(num_col);
+    dualproofvals.reserve(num_col);
+    dualproofinds.reserve(num_col);
   }
 
   lpsolver.getDualRaySparse(hasdualproof, row_ep);
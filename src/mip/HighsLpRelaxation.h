@@ -69,7 +69,6 @@ class HighsLpRelaxation {
   std::vector<double> dualproofbuffer;
   std::vector<double> colLbBuffer;
   std::vector<double> colUbBuffer;
-  HVector row_ep;
   HighsSparseVectorSum row_ap;
   double dualproofrhs;
   bool hasdualproof;
@@ -357,6 +357,15 @@ restart:
     // remove the iteration limit when installing a new node
     // mipdata_->lp.setIterationLimit();
 
+    // solve the LP relaxations of a batch of open nodes in parallel so that
+    // nodes exceeding the cutoff bound are pruned before they are installed
+    if (options_mip_->mip_parallel_search && !submip) {
+      mipdata_->evaluateOpenNodesInParallel();
+      mipdata_->lower_bound = std::min(mipdata_->upper_bound,
+                                       mipdata_->nodequeue.getBestLowerBound());
+      if (mipdata_->checkLimits()) break;
+    }
+
     // loop to install the next node for the search
     while (!mipdata_->nodequeue.empty()) {
       // printf("popping node from nodequeue (length = %" HIGHSINT_FORMAT ")\n",
@@ -505,6 +514,7 @@ void HighsMipSolver::cleanupSolve() {
   dual_bound_ += model_->offset_;
   primal_bound_ = mipdata_->upper_bound + model_->offset_;
   node_count_ = mipdata_->num_nodes;
+  parallel_pruned_node_count_ = mipdata_->num_nodes_parallel_pruned;
   total_lp_iterations_ = mipdata_->total_lp_iterations;
   dual_bound_ = std::min(dual_bound_, primal_bound_);
 
@@ -608,6 +618,10 @@ void HighsMipSolver::cleanupSolve() {
                (long long unsigned)mipdata_->sb_lp_iterations,
                (long long unsigned)mipdata_->sepa_lp_iterations,
                (long long unsigned)mipdata_->heuristic_lp_iterations);
+  if (options_mip_->mip_parallel_search)
+    highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                 "  Parallel search   %llu (nodes pruned)\n",
+                 (long long unsigned)mipdata_->num_nodes_parallel_pruned);
 
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
@@ -35,6 +35,7 @@ class HighsMipSolver {
   double primal_bound_;
   double gap_;
   int64_t node_count_;
+  int64_t parallel_pruned_node_count_;
   int64_t total_lp_iterations_;
 
   FILE* improving_solution_file_;
@@ -45,6 +46,8 @@ class HighsMipSolver {
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  // Raised when the solve is to be interrupted
+  HighsStopToken stop_token_;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
@@ -81,15 +81,17 @@ bool HighsMipSolverData::trySolution(const std::vector<double>& solution,
 
 void HighsMipSolverData::startAnalyticCenterComputation(
     const highs::parallel::TaskGroup& taskGroup) {
+  // the computation stops early when the task group is cancelled, e.g. due to
+  // early return in the root node evaluation, or on an interrupt or time limit
+  analyticCenterStopToken = taskGroup.getStopToken();
   taskGroup.spawn([&]() {
-    // first check if the analytic center computation should be cancelled, e.g.
-    // due to early return in the root node evaluation
     Highs ipm;
     ipm.setOptionValue("solver", "ipm");
     ipm.setOptionValue("run_crossover", kHighsOffString);
     ipm.setOptionValue("presolve", "off");
     ipm.setOptionValue("output_flag", false);
     ipm.setOptionValue("ipm_iteration_limit", 200);
+    ipm.setStopToken(analyticCenterStopToken);
     HighsLp lpmodel(*mipsolver.model_);
     lpmodel.col_cost_.assign(lpmodel.num_col_, 0.0);
     ipm.passModel(std::move(lpmodel));
@@ -155,6 +157,7 @@ void HighsMipSolverData::startSymmetryDetection(
   detectSymmetries = symData->symDetection.initializeDetection();
 
   if (detectSymmetries) {
+    symData->symDetection.setStopToken(taskGroup.getStopToken());
     taskGroup.spawn([&]() {
       double startTime = mipsolver.timer_.getWallTime();
       // highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
@@ -351,6 +354,9 @@ void HighsMipSolverData::init() {
   if (mipsolver.implicinit) implications.buildFrom(*mipsolver.implicinit);
   heuristic_effort = mipsolver.options_mip_->mip_heuristic_effort;
   detectSymmetries = mipsolver.options_mip_->mip_detect_symmetry;
+  stopSource = HighsStopSource(mipsolver.stop_token_);
+  stopSource.setTimeLimit(mipsolver.options_mip_->time_limit -
+                          mipsolver.timer_.read(mipsolver.timer_.solve_clock));
 
   firstlpsolobj = -kHighsInf;
   rootlpsolobj = -kHighsInf;
@@ -366,6 +372,7 @@ void HighsMipSolverData::init() {
   num_nodes_before_run = 0;
   num_leaves = 0;
   num_leaves_before_run = 0;
+  num_nodes_parallel_pruned = 0;
   total_lp_iterations = 0;
   heuristic_lp_iterations = 0;
   sepa_lp_iterations = 0;
@@ -1316,7 +1323,7 @@ void HighsMipSolverData::evaluateRootNode() {
     maxSepaRounds =
         std::min(HighsInt(2 * std::sqrt(maxTreeSizeLog2)), maxSepaRounds);
   std::unique_ptr<SymmetryDetectionData> symData;
-  highs::parallel::TaskGroup tg;
+  highs::parallel::TaskGroup tg(stopSource.getToken());
 restart:
   if (detectSymmetries) startSymmetryDetection(tg, symData);
   if (!analyticCenterComputed) startAnalyticCenterComputation(tg);
@@ -1703,6 +1710,21 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     return true;
   }
 
+  const HighsStopReason stopReason = mipsolver.stop_token_.stopReason();
+  if (stopReason != HighsStopReason::kNone) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      if (stopReason == HighsStopReason::kDeadline) {
+        highsLogDev(options.log_options, HighsLogType::kInfo,
+                    "reached time limit\n");
+        mipsolver.modelstatus_ = HighsModelStatus::kTimeLimit;
+      } else {
+        highsLogDev(options.log_options, HighsLogType::kInfo, "interrupted\n");
+        mipsolver.modelstatus_ = HighsModelStatus::kInterrupt;
+      }
+    }
+    return true;
+  }
+
   return false;
 }
 
@@ -1764,3 +1786,114 @@ void HighsMipSolverData::saveReportMipSolution(const double new_upper_limit) {
         mipsolver.options_mip_->mip_improving_solution_report_sparse);
   }
 }
+
+void HighsMipSolverData::evaluateOpenNodesInParallel() {
+  // with a single worker nothing is gained by solving the LPs of open nodes
+  // ahead of their installation
+  const HighsInt numWorkers = highs::parallel::num_threads();
+  if (numWorkers < 2) return;
+
+  const Highs& masterLp = lp.getLpSolver();
+  if (!masterLp.getBasis().valid) return;
+
+  // take the best bound nodes whose LP bound was not yet computed
+  std::vector<HighsNodeQueue::OpenNode> batch =
+      nodequeue.popBestBoundNodesWithoutLpBound(numWorkers);
+  const HighsInt numNodes = batch.size();
+  if (numNodes == 0) return;
+
+  // the worker LPs are set up serially since they copy the options of the
+  // master LP, while the model is copied by each worker independently
+  const double timeLeft = mipsolver.options_mip_->time_limit -
+                          mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  while ((HighsInt)searchWorkers.size() < numNodes) {
+    searchWorkers.emplace_back(new SearchWorker());
+    searchWorkers.back()->lpsolver.setOptionValue("output_flag", false);
+  }
+  for (HighsInt i = 0; i != numNodes; ++i) {
+    Highs& workerLp = searchWorkers[i]->lpsolver;
+    workerLp.passOptions(masterLp.getOptions());
+    workerLp.setOptionValue("output_flag", false);
+    workerLp.setOptionValue("time_limit", workerLp.getRunTime() + timeLeft);
+  }
+
+  const HighsLp& lpmodel = masterLp.getLp();
+  const HighsBasis& basis = masterLp.getBasis();
+  const HighsInt numCol = lpmodel.num_col_;
+
+  highs::parallel::for_each(0, numNodes, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; ++i) {
+      SearchWorker& worker = *searchWorkers[i];
+      worker.pruned = false;
+      worker.lp_bound = batch[i].lower_bound;
+      worker.lp_iterations = 0;
+      worker.lp_basis = nullptr;
+
+      worker.col_lower.assign(domain.col_lower_.begin(),
+                              domain.col_lower_.begin() + numCol);
+      worker.col_upper.assign(domain.col_upper_.begin(),
+                              domain.col_upper_.begin() + numCol);
+      for (const HighsDomainChange& domchg : batch[i].domchgstack) {
+        if (domchg.boundtype == HighsBoundType::kLower)
+          worker.col_lower[domchg.column] =
+              std::max(worker.col_lower[domchg.column], domchg.boundval);
+        else
+          worker.col_upper[domchg.column] =
+              std::min(worker.col_upper[domchg.column], domchg.boundval);
+
+        if (worker.col_lower[domchg.column] >
+            worker.col_upper[domchg.column] + feastol)
+          worker.pruned = true;
+      }
+      if (worker.pruned) continue;
+
+      worker.lpsolver.passModel(lpmodel);
+      worker.lpsolver.changeColsBounds(0, numCol - 1, worker.col_lower.data(),
+                                       worker.col_upper.data());
+      worker.lpsolver.setBasis(basis, "HighsMipSolverData::SearchWorker");
+      if (worker.lpsolver.run() == HighsStatus::kError) continue;
+
+      const HighsInfo& info = worker.lpsolver.getInfo();
+      worker.lp_iterations =
+          std::max(HighsInt{0}, info.simplex_iteration_count);
+      switch (worker.lpsolver.getModelStatus()) {
+        case HighsModelStatus::kObjectiveBound:
+        case HighsModelStatus::kInfeasible:
+          worker.pruned = true;
+          break;
+        case HighsModelStatus::kOptimal:
+          // only use the LP objective as bound if the solution is dual
+          // feasible for the unscaled LP
+          if (info.max_dual_infeasibility <= feastol)
+            worker.lp_bound =
+                std::max(worker.lp_bound, info.objective_function_value);
+          // the node starts from this basis when it is installed
+          if (worker.lpsolver.getBasis().valid)
+            worker.lp_basis =
+                std::make_shared<const HighsBasis>(worker.lpsolver.getBasis());
+          break;
+        default:
+          break;
+      }
+    }
+  });
+
+  for (HighsInt i = 0; i != numNodes; ++i) {
+    SearchWorker& worker = *searchWorkers[i];
+    HighsNodeQueue::OpenNode& node = batch[i];
+    total_lp_iterations += worker.lp_iterations;
+
+    // pruned nodes are not counted as searched nodes or leaves, since they
+    // were never installed
+    if (worker.pruned || worker.lp_bound > upper_limit) {
+      pruned_treeweight += std::ldexp(1.0, 1 - node.depth);
+      ++num_nodes_parallel_pruned;
+      continue;
+    }
+
+    pruned_treeweight += nodequeue.emplaceNode(
+        std::move(node.domchgstack), std::move(node.branchings),
+        worker.lp_bound, std::max(node.estimate, worker.lp_bound), node.depth,
+        true, std::move(worker.lp_basis));
+  }
+}
@@ -52,11 +52,15 @@ struct HighsMipSolverData {
   bool rowMatrixSet;
   bool analyticCenterComputed;
   HighsModelStatus analyticCenterStatus;
+  HighsStopToken analyticCenterStopToken;
   bool detectSymmetries;
   HighsInt numRestarts;
   HighsInt numRestartsRoot;
   HighsInt numCliqueEntriesAfterPresolve;
   HighsInt numCliqueEntriesAfterFirstPresolve;
+  // raised on an interrupt of the solve or once the time limit is reached,
+  // so that tasks and long running kernels return promptly
+  HighsStopSource stopSource;
 
   std::vector<HighsInt> ARstart_;
   std::vector<HighsInt> ARindex_;
@@ -113,6 +117,18 @@ struct HighsMipSolverData {
 
   HighsNodeQueue nodequeue;
 
+  struct SearchWorker {
+    Highs lpsolver;
+    std::vector<double> col_lower;
+    std::vector<double> col_upper;
+    double lp_bound;
+    std::shared_ptr<const HighsBasis> lp_basis;
+    HighsInt lp_iterations;
+    bool pruned;
+  };
+  std::vector<std::unique_ptr<SearchWorker>> searchWorkers;
+  int64_t num_nodes_parallel_pruned;
+
   HighsDebugSol debugSolution;
 
   HighsMipSolverData(HighsMipSolver& mipsolver)
@@ -175,6 +191,8 @@ struct HighsMipSolverData {
 
   void printDisplayLine(char first = ' ');
 
+  void evaluateOpenNodesInParallel();
+
   void getRow(HighsInt row, HighsInt& rowlen, const HighsInt*& rowinds,
               const double*& rowvals) const {
     HighsInt start = ARstart_[row];
@@ -364,7 +364,8 @@ double HighsNodeQueue::performBounding(double upper_limit) {
 double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
                                    std::vector<HighsInt>&& branchPositions,
                                    double lower_bound, double estimate,
-                                   HighsInt depth) {
+                                   HighsInt depth, bool lpBounded,
+                                   std::shared_ptr<const HighsBasis> lpBasis) {
   int64_t pos;
 
   assert(estimate != kHighsInf);
@@ -372,12 +373,14 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
   if (freeslots.empty()) {
     pos = nodes.size();
     nodes.emplace_back(std::move(domchgs), std::move(branchPositions),
-                       lower_bound, estimate, depth);
+                       lower_bound, estimate, depth, lpBounded,
+                       std::move(lpBasis));
   } else {
     pos = freeslots.top();
     freeslots.pop();
     nodes[pos] = OpenNode(std::move(domchgs), std::move(branchPositions),
-                          lower_bound, estimate, depth);
+                          lower_bound, estimate, depth, lpBounded,
+                          std::move(lpBasis));
   }
 
   assert(nodes[pos].lower_bound == lower_bound);
@@ -403,6 +406,31 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
   return std::move(nodes[bestBoundNode]);
 }
 
+std::vector<HighsNodeQueue::OpenNode>
+HighsNodeQueue::popBestBoundNodesWithoutLpBound(HighsInt maxNodes) {
+  // the nodes are selected first, since unlinking changes the tree. Only the
+  // first few nodes are scanned, so that the cost does not grow with the
+  // number of nodes that already have an LP bound
+  const HighsInt maxScan = 8 * maxNodes;
+  std::vector<int64_t> selected;
+  NodeLowerRbTree lowerTree(this);
+  HighsInt numScanned = 0;
+  for (int64_t node = lowerMin; node != -1 && numScanned < maxScan &&
+                                (HighsInt)selected.size() < maxNodes;
+       node = lowerTree.successor(node)) {
+    ++numScanned;
+    if (!nodes[node].lpBounded) selected.push_back(node);
+  }
+
+  std::vector<OpenNode> result;
+  result.reserve(selected.size());
+  for (int64_t node : selected) {
+    unlink(node);
+    result.push_back(std::move(nodes[node]));
+  }
+  return result;
+}
+
 double HighsNodeQueue::getBestLowerBound() const {
   double lb = lowerMin == -1 ? kHighsInf : nodes[lowerMin].lower_bound;
 
@@ -24,6 +24,8 @@
 #include "util/HighsCDouble.h"
 #include "util/HighsRbTree.h"
 
+struct HighsBasis;
+
 class HighsDomain;
 class HighsLpRelaxation;
 
@@ -146,6 +148,10 @@ class HighsNodeQueue {
     double lower_bound;
     double estimate;
     HighsInt depth;
+    // set when the node's LP bound was computed by a parallel search worker,
+    // in which case lpBasis holds the optimal basis of that LP if there is one
+    bool lpBounded;
+    std::shared_ptr<const HighsBasis> lpBasis;
     highs::RbTreeLinks<int64_t> lowerLinks;
     highs::RbTreeLinks<int64_t> hybridEstimLinks;
 
@@ -156,17 +162,22 @@ class HighsNodeQueue {
           lower_bound(-kHighsInf),
           estimate(-kHighsInf),
           depth(0),
+          lpBounded(false),
+          lpBasis(),
           lowerLinks(),
           hybridEstimLinks() {}
 
     OpenNode(std::vector<HighsDomainChange>&& domchgstack,
              std::vector<HighsInt>&& branchings, double lower_bound,
-             double estimate, HighsInt depth)
+             double estimate, HighsInt depth, bool lpBounded = false,
+             std::shared_ptr<const HighsBasis> lpBasis = nullptr)
         : domchgstack(domchgstack),
           branchings(branchings),
           lower_bound(lower_bound),
           estimate(estimate),
           depth(depth),
+          lpBounded(lpBounded),
+          lpBasis(std::move(lpBasis)),
           lowerLinks(),
           hybridEstimLinks() {}
 
@@ -240,12 +251,17 @@ class HighsNodeQueue {
 
   double emplaceNode(std::vector<HighsDomainChange>&& domchgs,
                      std::vector<HighsInt>&& branchings, double lower_bound,
-                     double estimate, HighsInt depth);
+                     double estimate, HighsInt depth, bool lpBounded = false,
+                     std::shared_ptr<const HighsBasis> lpBasis = nullptr);
 
   OpenNode&& popBestNode();
 
   OpenNode&& popBestBoundNode();
 
+  /// removes up to maxNodes nodes whose LP bound was not computed yet from
+  /// the queue, in order of their lower bound
+  std::vector<OpenNode> popBestBoundNodesWithoutLpBound(HighsInt maxNodes);
+
   int64_t numNodesUp(HighsInt col) const {
     return colLowerNodesPtr.get()[col].size();
   }
@@ -139,6 +139,7 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipsolver.pscostinit = &pscostinit;
   submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
   submipsolver.implicinit = &mipsolver.mipdata_->implications;
+  submipsolver.stop_token_ = mipsolver.stop_token_;
   submipsolver.run();
   if (submipsolver.mipdata_) {
     double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
@@ -952,9 +952,19 @@ void HighsSearch::installNode(HighsNodeQueue::OpenNode&& node) {
       }
     }
   }
+  // a node whose LP was solved by a parallel search worker starts from the
+  // optimal basis of that LP, so that its LP is not solved again from scratch
+  std::shared_ptr<const HighsBasis> nodeBasis;
+  if (node.lpBasis &&
+      (HighsInt)node.lpBasis->row_status.size() == lp->numRows())
+    nodeBasis = std::move(node.lpBasis);
   nodestack.emplace_back(
-      node.lower_bound, node.estimate, nullptr,
+      node.lower_bound, node.estimate, nodeBasis,
       globalSymmetriesValid ? mipsolver.mipdata_->globalOrbits : nullptr);
+  if (nodeBasis) {
+    lp->setStoredBasis(std::move(nodeBasis));
+    lp->recoverBasis();
+  }
   subrootsol.clear();
   depthoffset = node.depth - 1;
 }
@@ -101,7 +101,6 @@ class HighsCombinable {
       if (threadCopies_[i].initialized_) {
         combined =
             combine(std::move(combined), std::move(threadCopies_[i].data_));
-        break;
       }
     }
 
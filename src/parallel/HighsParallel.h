@@ -13,7 +13,11 @@
 #ifndef HIGHS_PARALLEL_H_
 #define HIGHS_PARALLEL_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "parallel/HighsMutex.h"
+#include "parallel/HighsStopToken.h"
 #include "parallel/HighsTaskExecutor.h"
 
 namespace highs {
@@ -22,10 +26,13 @@ namespace parallel {
 
 using mutex = HighsMutex;
 
-inline void initialize_scheduler(int numThreads = 0) {
-  if (numThreads == 0)
-    numThreads = (std::thread::hardware_concurrency() + 1) / 2;
-  HighsTaskExecutor::initialize(numThreads);
+inline int default_num_threads() {
+  return (std::thread::hardware_concurrency() + 1) / 2;
+}
+
+inline void initialize_scheduler(int numThreads = 0, bool pinThreads = false) {
+  if (numThreads == 0) numThreads = default_num_threads();
+  HighsTaskExecutor::initialize(numThreads, pinThreads);
 }
 
 inline int num_threads() {
@@ -68,6 +75,7 @@ inline void sync() { sync(HighsTaskExecutor::getThisWorkerDeque()); }
 class TaskGroup {
   HighsSplitDeque* workerDeque;
   int dequeHead;
+  mutable HighsStopSource stopSource;
 
  public:
   TaskGroup() {
@@ -75,6 +83,15 @@ class TaskGroup {
     dequeHead = workerDeque->getCurrentHead();
   }
 
+  /// task group whose stop tokens are also raised by the given token
+  explicit TaskGroup(const HighsStopToken& parentStop) : TaskGroup() {
+    stopSource = HighsStopSource(parentStop);
+  }
+
+  /// token for tasks of this group that run long enough to check whether
+  /// they should return early; it is raised when the group is cancelled
+  HighsStopToken getStopToken() const { return stopSource.getToken(); }
+
   template <typename F>
   void spawn(F&& f) const {
     highs::parallel::spawn(workerDeque, std::forward<F>(f));
@@ -93,6 +110,12 @@ class TaskGroup {
   void cancel() {
     for (int i = dequeHead; i < workerDeque->getCurrentHead(); ++i)
       workerDeque->cancelTask(i);
+    // tasks that already run are asked to stop, while tasks spawned after
+    // the cancellation receive fresh tokens
+    if (stopSource.stopPossible()) {
+      stopSource.requestStop();
+      stopSource.reset();
+    }
   }
 
   ~TaskGroup() {
@@ -121,6 +144,111 @@ void for_each(HighsInt start, HighsInt end, F&& f, HighsInt grainSize = 1) {
   }
 }
 
+/// Runs f(blockStart, blockEnd) for the blocks of grainSize indices that
+/// partition [start, end), in parallel if the calling thread belongs to a
+/// scheduler. The blocks only depend on the range and grainSize.
+template <typename F>
+void for_each_block(HighsInt start, HighsInt end, F&& f,
+                    HighsInt grainSize = 1) {
+  const HighsInt numBlocks = (end - start + grainSize - 1) / grainSize;
+  auto runBlocks = [&](HighsInt firstBlock, HighsInt lastBlock) {
+    for (HighsInt block = firstBlock; block < lastBlock; ++block)
+      f(start + block * grainSize,
+        std::min(end, start + (block + 1) * grainSize));
+  };
+  if (numBlocks > 1 && HighsTaskExecutor::getThisWorkerDeque() != nullptr)
+    for_each(0, numBlocks, runBlocks);
+  else
+    runBlocks(0, numBlocks);
+}
+
+/// Reduces [start, end) in parallel. f(blockStart, blockEnd) returns the
+/// partial result of a block and the partial results are combined from left
+/// to right, starting with init. As the blocks do not depend on the number
+/// of threads, the result is reproducible even for operations that are not
+/// associative, such as floating point sums.
+template <typename T, typename F, typename FCombine>
+T reduce(HighsInt start, HighsInt end, T init, F&& f, FCombine&& combine,
+         HighsInt grainSize = 1) {
+  if (end <= start) return init;
+  const HighsInt numBlocks = (end - start + grainSize - 1) / grainSize;
+  if (numBlocks == 1) return combine(std::move(init), f(start, end));
+
+  std::vector<T> partial(numBlocks);
+  for_each_block(
+      start, end,
+      [&](HighsInt blockStart, HighsInt blockEnd) {
+        partial[(blockStart - start) / grainSize] = f(blockStart, blockEnd);
+      },
+      grainSize);
+
+  for (T& blockResult : partial)
+    init = combine(std::move(init), std::move(blockResult));
+  return init;
+}
+
+/// Combines transform(i) for i in [start, end) with the same block structure
+/// and combination order as reduce()
+template <typename T, typename FTransform, typename FCombine>
+T transform_reduce(HighsInt start, HighsInt end, T init,
+                   FTransform&& transform, FCombine&& combine,
+                   HighsInt grainSize = 1) {
+  return reduce(
+      start, end, std::move(init),
+      [&](HighsInt blockStart, HighsInt blockEnd) {
+        T blockResult = transform(blockStart);
+        for (HighsInt i = blockStart + 1; i < blockEnd; ++i)
+          blockResult = combine(std::move(blockResult), transform(i));
+        return blockResult;
+      },
+      combine, grainSize);
+}
+
+/// Exclusive prefix scan in place: values[i] is replaced by the combination
+/// of init and values[0], ..., values[i - 1]. Returns the combination of
+/// init and all values. The block sums are scanned serially, so the result
+/// does not depend on the number of threads.
+template <typename T, typename FCombine>
+T scan(T* values, HighsInt size, T init, FCombine&& combine,
+       HighsInt grainSize = 1) {
+  if (size <= 0) return init;
+  const HighsInt numBlocks = (size + grainSize - 1) / grainSize;
+  std::vector<T> blockOffset(numBlocks);
+  if (numBlocks > 1) {
+    for_each_block(
+        0, size,
+        [&](HighsInt blockStart, HighsInt blockEnd) {
+          T blockSum = values[blockStart];
+          for (HighsInt i = blockStart + 1; i < blockEnd; ++i)
+            blockSum = combine(std::move(blockSum), values[i]);
+          blockOffset[blockStart / grainSize] = std::move(blockSum);
+        },
+        grainSize);
+  }
+  // turn the block sums into the offsets at which the blocks start
+  T total = std::move(init);
+  for (HighsInt block = 0; block < numBlocks; ++block) {
+    T blockSum = std::move(blockOffset[block]);
+    blockOffset[block] = total;
+    if (block + 1 < numBlocks) total = combine(std::move(total), blockSum);
+  }
+
+  for_each_block(
+      0, size,
+      [&](HighsInt blockStart, HighsInt blockEnd) {
+        T running = blockOffset[blockStart / grainSize];
+        for (HighsInt i = blockStart; i < blockEnd; ++i) {
+          T value = std::move(values[i]);
+          values[i] = running;
+          running = combine(std::move(running), std::move(value));
+        }
+        if (blockEnd == size) blockOffset.back() = std::move(running);
+      },
+      grainSize);
+
+  return std::move(blockOffset.back());
+}
+
 }  // namespace parallel
 
 }  // namespace highs
@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "parallel/HighsBinarySemaphore.h"
 #include "parallel/HighsCacheAlign.h"
@@ -51,6 +52,22 @@ class HighsSplitDeque {
     bool allStolenCopy = true;
   };
 
+  struct NumaData {
+    // workers on the same NUMA node, empty unless the workers are spread
+    // over several nodes
+    std::vector<int> numaPeers;
+    uint32_t numStealAttempts = 0;
+  };
+
+  struct StatsData {
+    // cumulative counters that only the owner writes but any thread may read
+    std::atomic<int64_t> numTasksRun{0};
+    std::atomic<int64_t> numSteals{0};
+    std::atomic<int64_t> numFailedSteals{0};
+    std::atomic<int64_t> stealNanoSecs{0};
+    std::atomic<int64_t> idleNanoSecs{0};
+  };
+
   struct StealerData {
     HighsBinarySemaphore semaphore{0};
     HighsTask* injectedTask{nullptr};
@@ -165,7 +182,9 @@ class HighsSplitDeque {
 
     HighsTask* waitForNewTask(HighsSplitDeque* localDeque) {
       pushSleeper(localDeque);
+      auto tStart = std::chrono::high_resolution_clock::now();
       localDeque->stealerData.semaphore.acquire();
+      localDeque->addElapsedTime(localDeque->statsData.idleNanoSecs, tStart);
       return localDeque->stealerData.injectedTask;
     }
   };
@@ -183,6 +202,23 @@ class HighsSplitDeque {
   alignas(64) StealerData stealerData;
   alignas(64) WorkerBunkData workerBunkData;
   alignas(64) std::array<HighsTask, kTaskArraySize> taskArray;
+  NumaData numaData;
+  StatsData statsData;
+
+  static void addToCounter(std::atomic<int64_t>& counter, int64_t value) {
+    // there is a single writer, so no atomic read-modify-write is needed
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+  }
+
+  static void addElapsedTime(
+      std::atomic<int64_t>& counter,
+      std::chrono::high_resolution_clock::time_point tStart) {
+    addToCounter(counter,
+                 std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::high_resolution_clock::now() - tStart)
+                     .count());
+  }
 
   void growShared() {
     int haveJobs =
@@ -287,6 +323,7 @@ class HighsSplitDeque {
         growShared();
 
       ownerData.head += 1;
+      addToCounter(statsData.numTasksRun, 1);
       f();
       return;
     }
@@ -346,6 +383,7 @@ class HighsSplitDeque {
     } else if (ownerData.head != ownerData.splitCopy)
       growShared();
 
+    addToCounter(statsData.numTasksRun, 1);
     return std::make_pair(Status::kWork, &taskArray[ownerData.head]);
   }
 
@@ -428,13 +466,27 @@ class HighsSplitDeque {
   }
 
   HighsTask* randomSteal() {
-    HighsInt next = ownerData.randgen.integer(ownerData.numWorkers - 1);
-    next += next >= ownerData.ownerId;
+    HighsInt next;
+    // every other attempt is restricted to victims on the same NUMA node, so
+    // that stolen tasks tend to work on node-local memory
+    if (!numaData.numaPeers.empty() &&
+        (numaData.numStealAttempts++ & 1u) == 0) {
+      next = numaData.numaPeers[ownerData.randgen.integer(
+          numaData.numaPeers.size())];
+    } else {
+      next = ownerData.randgen.integer(ownerData.numWorkers - 1);
+      next += next >= ownerData.ownerId;
+    }
     assert(next != ownerData.ownerId);
     assert(next >= 0);
     assert(next < ownerData.numWorkers);
 
-    return ownerData.workers[next]->steal();
+    HighsTask* task = ownerData.workers[next]->steal();
+    if (task)
+      addToCounter(statsData.numSteals, 1);
+    else
+      addToCounter(statsData.numFailedSteals, 1);
+    return task;
   }
 
   void injectTaskAndNotify(HighsTask* t) {
@@ -448,6 +500,7 @@ class HighsSplitDeque {
   void wait() { stealerData.semaphore.acquire(); }
 
   void runStolenTask(HighsTask* task) {
+    addToCounter(statsData.numTasksRun, 1);
     HighsTask* prevRootTask = ownerData.rootTask;
     ownerData.rootTask = task;
     uint32_t currentHead = ownerData.head;
@@ -561,7 +614,9 @@ class HighsSplitDeque {
 
     if (!t->requestNotifyWhenFinished(this, stealer)) return;
 
+    auto tStart = std::chrono::high_resolution_clock::now();
     stealerData.semaphore.acquire(std::move(lg));
+    addElapsedTime(statsData.idleNanoSecs, tStart);
   }
 
   void yield() {
@@ -571,6 +626,37 @@ class HighsSplitDeque {
 
   int getOwnerId() const { return ownerData.ownerId; }
 
+  struct WorkerStats {
+    int64_t numTasksRun = 0;
+    int64_t numSteals = 0;
+    int64_t numFailedSteals = 0;
+    // seconds spent in the random steal loop
+    double stealTime = 0.0;
+    // seconds spent waiting for a new task or for a stolen task to finish
+    double idleTime = 0.0;
+  };
+
+  WorkerStats getStats() const {
+    WorkerStats stats;
+    stats.numTasksRun = statsData.numTasksRun.load(std::memory_order_relaxed);
+    stats.numSteals = statsData.numSteals.load(std::memory_order_relaxed);
+    stats.numFailedSteals =
+        statsData.numFailedSteals.load(std::memory_order_relaxed);
+    stats.stealTime =
+        1e-9 * statsData.stealNanoSecs.load(std::memory_order_relaxed);
+    stats.idleTime =
+        1e-9 * statsData.idleNanoSecs.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  void addStealTime(std::chrono::high_resolution_clock::time_point tStart) {
+    addElapsedTime(statsData.stealNanoSecs, tStart);
+  }
+
+  void setNumaPeers(std::vector<int> numaPeers) {
+    numaData.numaPeers = std::move(numaPeers);
+  }
+
   int getNumWorkers() const { return ownerData.numWorkers; }
 
   int getCurrentHead() const { return ownerData.head; }
@@ -0,0 +1,158 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2021 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Qi Huangfu, Leona Gottwald    */
+/*    and Michael Feldmeier                                              */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef HIGHS_STOP_TOKEN_H_
+#define HIGHS_STOP_TOKEN_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+/// Why a stop was requested: explicitly, or because a deadline passed
+enum class HighsStopReason { kNone, kRequest, kDeadline };
+
+/// Shared state of a stop source and its tokens. A stop is requested
+/// explicitly, once the optional deadline has passed, or when the parent
+/// state requests a stop, in which case the parent's reason is inherited.
+class HighsStopState {
+  using clock = std::chrono::steady_clock;
+
+  // the clock is only read on every kClockPollInterval-th poll
+  static constexpr uint32_t kClockPollInterval = 64;
+
+  std::atomic<HighsStopReason> reason{HighsStopReason::kNone};
+  std::atomic<int64_t> deadline{std::numeric_limits<int64_t>::max()};
+  std::atomic<uint32_t> numPolls{0};
+  std::shared_ptr<HighsStopState> parent;
+
+  static int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               clock::now().time_since_epoch())
+        .count();
+  }
+
+  // latch the first reason so that later polls need not read the clock or
+  // the parent
+  void latch(HighsStopReason stopReason) {
+    HighsStopReason none = HighsStopReason::kNone;
+    reason.compare_exchange_strong(none, stopReason,
+                                   std::memory_order_relaxed);
+  }
+
+ public:
+  explicit HighsStopState(std::shared_ptr<HighsStopState> parent)
+      : parent(std::move(parent)) {}
+
+  void requestStop() { latch(HighsStopReason::kRequest); }
+
+  void setTimeLimit(double seconds) {
+    if (!(seconds < 1e9)) return;
+    int64_t newDeadline = now() + int64_t(std::max(seconds, 0.0) * 1e9);
+    int64_t current = deadline.load(std::memory_order_relaxed);
+    while (current > newDeadline) {
+      if (deadline.compare_exchange_weak(current, newDeadline,
+                                         std::memory_order_relaxed,
+                                         std::memory_order_relaxed))
+        break;
+    }
+    // read the clock on the next poll
+    numPolls.store(0, std::memory_order_relaxed);
+  }
+
+  HighsStopReason stopReason() {
+    HighsStopReason stopReason = reason.load(std::memory_order_relaxed);
+    if (stopReason != HighsStopReason::kNone) return stopReason;
+    if (parent) {
+      stopReason = parent->stopReason();
+      if (stopReason != HighsStopReason::kNone) {
+        latch(stopReason);
+        return reason.load(std::memory_order_relaxed);
+      }
+    }
+    int64_t stopTime = deadline.load(std::memory_order_relaxed);
+    if (stopTime != std::numeric_limits<int64_t>::max() &&
+        numPolls.fetch_add(1, std::memory_order_relaxed) %
+                kClockPollInterval ==
+            0 &&
+        now() >= stopTime)
+      latch(HighsStopReason::kDeadline);
+    return reason.load(std::memory_order_relaxed);
+  }
+
+  bool stopRequested() { return stopReason() != HighsStopReason::kNone; }
+};
+
+/// Cheap handle that long running code polls to learn whether it should
+/// return early. A default constructed token never requests a stop.
+class HighsStopToken {
+  std::shared_ptr<HighsStopState> state;
+
+  friend class HighsStopSource;
+  explicit HighsStopToken(std::shared_ptr<HighsStopState> state)
+      : state(std::move(state)) {}
+
+ public:
+  HighsStopToken() = default;
+
+  bool stopPossible() const { return state != nullptr; }
+
+  bool stopRequested() const { return state && state->stopRequested(); }
+
+  HighsStopReason stopReason() const {
+    return state ? state->stopReason() : HighsStopReason::kNone;
+  }
+};
+
+/// Owner side of a stop token. The shared state is only allocated once a
+/// token is handed out, a stop is requested or a time limit is set, so that
+/// sources which are never observed cost nothing.
+class HighsStopSource {
+  std::shared_ptr<HighsStopState> state;
+  std::shared_ptr<HighsStopState> parent;
+
+  HighsStopState& getState() {
+    if (!state) state = std::make_shared<HighsStopState>(parent);
+    return *state;
+  }
+
+ public:
+  HighsStopSource() = default;
+
+  /// source whose tokens are also raised when the parent token is raised
+  explicit HighsStopSource(const HighsStopToken& parentToken)
+      : parent(parentToken.state) {}
+
+  HighsStopToken getToken() {
+    getState();
+    return HighsStopToken(state);
+  }
+
+  void requestStop() { getState().requestStop(); }
+
+  /// whether tokens have been handed out or a stop or time limit is set
+  bool stopPossible() const { return state != nullptr; }
+
+  /// detach from the tokens handed out so far, so that tokens handed out
+  /// later are not raised by earlier stop requests or time limits
+  void reset() { state.reset(); }
+
+  /// request a stop once the given number of seconds have passed
+  void setTimeLimit(double seconds) { getState().setTimeLimit(seconds); }
+
+  bool stopRequested() const { return state && state->stopRequested(); }
+};
+
+#endif
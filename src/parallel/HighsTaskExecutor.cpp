@@ -1,5 +1,12 @@
 #include "parallel/HighsTaskExecutor.h"
 
+#ifdef __linux__
+#include <sched.h>
+
+#include <fstream>
+#include <string>
+#endif
+
 using namespace highs;
 
 #ifdef _WIN32
@@ -23,5 +30,75 @@ thread_local HighsTaskExecutor::ExecutorHandle
 
 HighsTaskExecutor::ExecutorHandle::~ExecutorHandle() {
   if (ptr && this == ptr->mainWorkerHandle.load(std::memory_order_relaxed))
-    HighsTaskExecutor::shutdown();
+    HighsTaskExecutor::shutdown(*this);
+}
+
+#ifdef __linux__
+std::vector<int> HighsTaskExecutor::getAllowedCpus() {
+  std::vector<int> cpus;
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0) return cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    if (CPU_ISSET(cpu, &cpuSet)) cpus.push_back(cpu);
+  return cpus;
 }
+
+std::vector<int> HighsTaskExecutor::getCpuNumaNodes(
+    const std::vector<int>& cpus) {
+  // read the CPU ranges of each node, e.g. "0-15,32-47", from sysfs. Without
+  // NUMA information every CPU is taken to be on node 0
+  std::vector<int> nodeOfCpu(CPU_SETSIZE, 0);
+  for (int node = 0;; ++node) {
+    std::ifstream cpulist("/sys/devices/system/node/node" +
+                          std::to_string(node) + "/cpulist");
+    if (!cpulist) break;
+    int first;
+    while (cpulist >> first) {
+      int last = first;
+      if (cpulist.peek() == '-') {
+        cpulist.get();
+        cpulist >> last;
+      }
+      for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+        if (cpu >= 0) nodeOfCpu[cpu] = node;
+      if (cpulist.peek() == ',') cpulist.get();
+    }
+  }
+  std::vector<int> cpuNodes;
+  cpuNodes.reserve(cpus.size());
+  for (int cpu : cpus) cpuNodes.push_back(nodeOfCpu[cpu]);
+  return cpuNodes;
+}
+
+int HighsTaskExecutor::getNumaNodeOfThisThread(
+    const std::vector<int>& cpus, const std::vector<int>& cpuNodes) {
+  const int cpu = sched_getcpu();
+  for (size_t i = 0; i < cpus.size(); ++i)
+    if (cpus[i] == cpu) return cpuNodes[i];
+  return cpuNodes.empty() ? 0 : cpuNodes[0];
+}
+
+void HighsTaskExecutor::pinThisThread(int cpu) {
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(cpu, &cpuSet);
+  sched_setaffinity(0, sizeof(cpu_set_t), &cpuSet);
+}
+#else
+std::vector<int> HighsTaskExecutor::getAllowedCpus() {
+  return std::vector<int>();
+}
+
+std::vector<int> HighsTaskExecutor::getCpuNumaNodes(
+    const std::vector<int>& cpus) {
+  return std::vector<int>(cpus.size(), 0);
+}
+
+int HighsTaskExecutor::getNumaNodeOfThisThread(const std::vector<int>&,
+                                               const std::vector<int>&) {
+  return 0;
+}
+
+void HighsTaskExecutor::pinThisThread(int) {}
+#endif
@@ -55,6 +55,16 @@ class HighsTaskExecutor {
   std::vector<cache_aligned::unique_ptr<HighsSplitDeque>> workerDeques;
   cache_aligned::shared_ptr<HighsSplitDeque::WorkerBunk> workerBunk;
   std::atomic<ExecutorHandle*> mainWorkerHandle;
+  bool pinThreads;
+
+  // platform specific helpers for thread pinning, defined in
+  // HighsTaskExecutor.cpp. Without support for thread affinities the CPU list
+  // is empty and pinning has no effect.
+  static std::vector<int> getAllowedCpus();
+  static std::vector<int> getCpuNumaNodes(const std::vector<int>& cpus);
+  static int getNumaNodeOfThisThread(const std::vector<int>& cpus,
+                                     const std::vector<int>& cpuNodes);
+  static void pinThisThread(int cpu);
 
   HighsTask* random_steal_loop(HighsSplitDeque* localDeque) {
     const int numWorkers = workerDeques.size();
@@ -66,7 +76,10 @@ class HighsTaskExecutor {
     while (true) {
       for (int s = 0; s < numTries; ++s) {
         HighsTask* task = localDeque->randomSteal();
-        if (task) return task;
+        if (task) {
+          localDeque->addStealTime(tStart);
+          return task;
+        }
       }
 
       if (!workerBunk->haveJobs.load(std::memory_order_relaxed)) break;
@@ -82,6 +95,7 @@ class HighsTaskExecutor {
         break;
     }
 
+    localDeque->addStealTime(tStart);
     return nullptr;
   }
 
@@ -106,40 +120,148 @@ class HighsTaskExecutor {
   }
 
  public:
-  HighsTaskExecutor(int numThreads) {
+  HighsTaskExecutor(int numThreads, bool pinThreads = false)
+      : pinThreads(pinThreads) {
     assert(numThreads > 0);
     mainWorkerHandle.store(nullptr, std::memory_order_relaxed);
     workerDeques.resize(numThreads);
     workerBunk = cache_aligned::make_shared<HighsSplitDeque::WorkerBunk>();
-    for (int i = 0; i < numThreads; ++i)
-      workerDeques[i] = cache_aligned::make_unique<HighsSplitDeque>(
-          workerBunk, workerDeques.data(), i, numThreads);
+    std::vector<int> cpus;
+    if (pinThreads) cpus = getAllowedCpus();
+    if (cpus.empty()) {
+      for (int i = 0; i < numThreads; ++i)
+        workerDeques[i] = cache_aligned::make_unique<HighsSplitDeque>(
+            workerBunk, workerDeques.data(), i, numThreads);
+
+      for (int i = 1; i < numThreads; ++i)
+        std::thread([&](int id) { run_worker(id); }, i).detach();
+      return;
+    }
 
-    threadLocalWorkerDeque() = workerDeques[0].get();
-    for (int i = 1; i < numThreads; ++i)
-      std::thread([&](int id) { run_worker(id); }, i).detach();
+    // pin worker i to the i-th allowed CPU, leaving the calling thread that
+    // acts as worker 0 unpinned, since its affinity belongs to the caller.
+    // Worker 0 is counted on the NUMA node it runs on now. Each worker
+    // allocates its own deque after it is pinned, so that first touch places
+    // the deque on the worker's NUMA node.
+    const std::vector<int> cpuNodes = getCpuNumaNodes(cpus);
+    std::vector<int> workerNode(numThreads);
+    workerNode[0] = getNumaNodeOfThisThread(cpus, cpuNodes);
+    workerDeques[0] = cache_aligned::make_unique<HighsSplitDeque>(
+        workerBunk, workerDeques.data(), 0, numThreads);
+    std::atomic<int> numDequesCreated{1};
+    for (int i = 1; i < numThreads; ++i) {
+      const int cpuIndex = i % cpus.size();
+      workerNode[i] = cpuNodes[cpuIndex];
+      std::thread(
+          [&](int id, int cpu) {
+            pinThisThread(cpu);
+            workerDeques[id] = cache_aligned::make_unique<HighsSplitDeque>(
+                workerBunk, workerDeques.data(), id, numThreads);
+            numDequesCreated.fetch_add(1, std::memory_order_release);
+            run_worker(id);
+          },
+          i, cpus[cpuIndex])
+          .detach();
+    }
+    while (numDequesCreated.load(std::memory_order_acquire) < numThreads)
+      HighsSpinMutex::yieldProcessor();
+
+    // workers prefer to steal from workers on their own node, unless all
+    // workers share one node
+    for (int i = 0; i < numThreads; ++i) {
+      std::vector<int> numaPeers;
+      for (int j = 0; j < numThreads; ++j)
+        if (j != i && workerNode[j] == workerNode[i]) numaPeers.push_back(j);
+      if ((int)numaPeers.size() < numThreads - 1)
+        workerDeques[i]->setNumaPeers(std::move(numaPeers));
+    }
   }
 
   static HighsSplitDeque* getThisWorkerDeque() {
     return threadLocalWorkerDeque();
   }
 
+  /// handle of the global executor of the calling thread
+  static const ExecutorHandle& getGlobalExecutorHandle() {
+    return threadLocalExecutorHandle();
+  }
+
   static int getNumWorkerThreads() {
     return threadLocalWorkerDeque()->getNumWorkers();
   }
 
-  static void initialize(int numThreads) {
+  /// cumulative statistics of every worker of the executor owned by the
+  /// given handle, empty if the handle owns no executor
+  static std::vector<HighsSplitDeque::WorkerStats> getWorkerStats(
+      const ExecutorHandle& executorHandle) {
+    std::vector<HighsSplitDeque::WorkerStats> workerStats;
+    if (!executorHandle.ptr) return workerStats;
+    const auto& workerDeques = executorHandle.ptr->workerDeques;
+    workerStats.reserve(workerDeques.size());
+    for (const auto& workerDeque : workerDeques)
+      workerStats.push_back(workerDeque->getStats());
+    return workerStats;
+  }
+
+  static int getNumWorkerThreads(const ExecutorHandle& executorHandle) {
+    return executorHandle.ptr ? executorHandle.ptr->workerDeques.size() : 0;
+  }
+
+  static bool getPinThreads(const ExecutorHandle& executorHandle) {
+    return executorHandle.ptr && executorHandle.ptr->pinThreads;
+  }
+
+  /// create an executor owned by the given handle, e.g. one held by a solver
+  /// instance, without making it the executor of the calling thread
+  static void initialize(ExecutorHandle& executorHandle, int numThreads,
+                         bool pinThreads = false) {
+    assert(!executorHandle.ptr);
+    executorHandle.ptr =
+        cache_aligned::make_shared<HighsTaskExecutor>(numThreads, pinThreads);
+    executorHandle.ptr->mainWorkerHandle.store(&executorHandle,
+                                               std::memory_order_release);
+  }
+
+  static void initialize(int numThreads, bool pinThreads = false) {
     auto& executorHandle = threadLocalExecutorHandle();
-    if (!executorHandle.ptr) {
-      executorHandle.ptr =
-          cache_aligned::make_shared<HighsTaskExecutor>(numThreads);
-      executorHandle.ptr->mainWorkerHandle.store(&executorHandle,
-                                                 std::memory_order_release);
+    // a thread that currently runs an executor owned by some other handle
+    // does not need the global executor
+    if (!executorHandle.ptr && !threadLocalWorkerDeque()) {
+      initialize(executorHandle, numThreads, pinThreads);
+      threadLocalWorkerDeque() = executorHandle.ptr->workerDeques[0].get();
     }
   }
 
+  /// while in scope, the calling thread acts as the main worker of the
+  /// executor owned by the given handle, if the handle owns one. Only one
+  /// thread may use an executor this way at any time.
+  class ScopedExecutor {
+    HighsSplitDeque* savedWorkerDeque;
+
+   public:
+    explicit ScopedExecutor(const ExecutorHandle& executorHandle)
+        : savedWorkerDeque(threadLocalWorkerDeque()) {
+      if (executorHandle.ptr)
+        threadLocalWorkerDeque() = executorHandle.ptr->workerDeques[0].get();
+    }
+
+    ScopedExecutor(const ScopedExecutor&) = delete;
+    ScopedExecutor& operator=(const ScopedExecutor&) = delete;
+
+    ~ScopedExecutor() { threadLocalWorkerDeque() = savedWorkerDeque; }
+  };
+
   static void shutdown(bool blocking = false) {
     auto& executorHandle = threadLocalExecutorHandle();
+    if (executorHandle.ptr) {
+      if (threadLocalWorkerDeque() ==
+          executorHandle.ptr->workerDeques[0].get())
+        threadLocalWorkerDeque() = nullptr;
+      shutdown(executorHandle, blocking);
+    }
+  }
+
+  static void shutdown(ExecutorHandle& executorHandle, bool blocking = false) {
     if (executorHandle.ptr) {
       // first spin until every worker has acquired its executor reference
       while (executorHandle.ptr.use_count() !=
@@ -4448,7 +4448,15 @@ HPresolve::Result HPresolve::removeDependentEquations(
   std::vector<HighsInt> colSet(matrix.num_col_);
   std::iota(colSet.begin(), colSet.end(), 0);
   HFactor factor;
-  factor.setup(matrix, colSet);
+  if (factor.setup(matrix, colSet) == kSetupReturnIndexOverflow) {
+    // The equations are too many to be factored, so just return
+    highsLogDev(options->log_options, HighsLogType::kWarning,
+                "HPresolve::removeDependentEquations Too many equations\n");
+    analysis_.logging_on_ = logging_on;
+    if (logging_on)
+      analysis_.stopPresolveRuleLog(kPresolveRuleDependentFreeCols);
+    return Result::kOk;
+  }
   // Set up a time limit to prevent the redundant rows factorization
   // taking forever.
   //
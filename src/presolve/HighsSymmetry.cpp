@@ -1699,6 +1699,10 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
   HighsInt maxPerms = 64000000 / numActiveCols;
   HighsSplitDeque* workerDeque = HighsTaskExecutor::getThisWorkerDeque();
   while (!nodeStack.empty()) {
+    if (stopToken.stopRequested()) {
+      symmetries.clear();
+      return;
+    }
     HighsInt targetCell = selectTargetCell();
     if (targetCell == -1) {
       if (firstLeavePartition.empty()) {
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "lp_data/HighsLp.h"
+#include "parallel/HighsStopToken.h"
 #include "util/HighsDisjointSets.h"
 #include "util/HighsHash.h"
 #include "util/HighsInt.h"
@@ -199,6 +200,8 @@ class HighsSymmetryDetection {
 
   std::vector<Node> nodeStack;
 
+  HighsStopToken stopToken;
+
   HighsInt getCellStart(HighsInt pos);
 
   void backtrack(HighsInt backtrackStackNewEnd, HighsInt backtrackStackEnd);
@@ -275,6 +278,9 @@ class HighsSymmetryDetection {
  public:
   void loadModelAsGraph(const HighsLp& model, double epsilon);
 
+  /// set a token that stops the search early, with no symmetries detected
+  void setStopToken(const HighsStopToken& token) { stopToken = token; }
+
   bool initializeDetection();
 
   void run(HighsSymmetries& symmetries);
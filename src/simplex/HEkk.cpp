@@ -23,6 +23,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/HSimplexReport.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HVectorPool.h"
 
 using std::fabs;
 using std::max;
@@ -42,6 +43,9 @@ void HEkk::clear() {
   this->basis_.clear();
   this->simplex_nla_.clear();
   this->clearEkkAllStatus();
+  // The free vectors of this thread's pool have the dimensions of the
+  // cleared LP, so release their storage
+  HVectorPool::threadPool().clear();
 }
 
 void HEkk::clearEkkAllStatus() {
@@ -86,6 +90,8 @@ void HEkk::clearNlaInvertStatus() {
 void HEkk::clearEkkPointers() {
   this->options_ = NULL;
   this->timer_ = NULL;
+  this->race_timer_ = NULL;
+  this->stop_token_ = HighsStopToken();
 }
 
 void HEkk::clearEkkLp() {
@@ -445,6 +451,8 @@ void HEkk::moveLp(HighsLpSolverObject& solver_object) {
   // HighsOptions and HighsTimer members of the Highs class that are
   // communicated by reference via the HighsLpSolverObject instance.
   this->setPointers(&solver_object.options_, &solver_object.timer_);
+  this->race_timer_ = solver_object.race_timer_;
+  this->stop_token_ = solver_object.stop_token_;
   // Initialise Ekk if this has not been done. Ekk isn't initialised
   // if moveLp hasn't been called for this instance of HiGHS, or if
   // the Ekk instance is junked due to removing rows from the LP
@@ -1140,6 +1148,8 @@ HighsStatus HEkk::solve(const bool force_phase2) {
   // Can model_status_ = HighsModelStatus::kNotset be returned?
   assert(model_status_ != HighsModelStatus::kNotset);
 
+  putFactorCache();
+
   if (analysis_.analyse_simplex_summary_data) analysis_.summaryReport();
   if (analysis_.analyse_factor_data) analysis_.reportInvertFormData();
   if (analysis_.analyse_factor_time) analysis_.reportFactorTimer();
@@ -1522,16 +1532,19 @@ HighsStatus HEkk::initialiseSimplexLpBasisAndFactor(
   } else {
     // todo @ Julian: this fails on glass4
     assert(info_.factor_pivot_threshold >= options_->factor_pivot_threshold);
-    simplex_nla_.setup(
-        &(this->lp_),                     //&lp_,
-        this->basis_.basicIndex_.data(),  // basis_.basicIndex_.data(),
-        this->options_,                   // options_,
-        this->timer_,                     // timer_,
-        &(this->analysis_),               //&analysis_,
-        local_scaled_a_matrix, this->info_.factor_pivot_threshold);
+    if (simplex_nla_.setup(
+            &(this->lp_),                     //&lp_,
+            this->basis_.basicIndex_.data(),  // basis_.basicIndex_.data(),
+            this->options_,                   // options_,
+            this->timer_,                     // timer_,
+            &(this->analysis_),               //&analysis_,
+            local_scaled_a_matrix, this->info_.factor_pivot_threshold))
+      return HighsStatus::kError;
     status_.has_nla = true;
   }
 
+  // A cached INVERT comes with its own synthetic clock
+  if (!status_.has_invert) getFactorCache();
   if (!status_.has_invert) {
     const HighsInt rank_deficiency = computeFactor();
     if (rank_deficiency) {
@@ -2083,11 +2096,16 @@ void HEkk::computeDualSteepestEdgeWeights(const bool initial) {
     analysis_.simplexTimerStart(DseIzClock);
   }
   const HighsInt num_row = lp_.num_row_;
-  HVector row_ep;
-  row_ep.setup(num_row);
   assert((HighsInt)dual_edge_weight_.size() >= num_row);
-  for (HighsInt iRow = 0; iRow < num_row; iRow++)
-    dual_edge_weight_[iRow] = computeDualSteepestEdgeWeight(iRow, row_ep);
+  const HighsInt num_threads = highs::parallel::num_threads();
+  if (num_threads > 1 && num_row >= kParallelDseMinNumRow) {
+    computeDualSteepestEdgeWeightsParallel(num_threads);
+  } else {
+    PooledHVector pooled_row_ep(num_row);
+    HVector& row_ep = *pooled_row_ep;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      dual_edge_weight_[iRow] = computeDualSteepestEdgeWeight(iRow, row_ep);
+  }
   if (analysis_.analyse_simplex_time) {
     analysis_.simplexTimerStop(SimplexIzDseWtClock);
     analysis_.simplexTimerStop(DseIzClock);
@@ -2100,17 +2118,69 @@ void HEkk::computeDualSteepestEdgeWeights(const bool initial) {
   }
 }
 
+void HEkk::computeDualSteepestEdgeWeightsParallel(const HighsInt num_threads) {
+  // The expected density of each BTRAN is the running value of
+  // row_ep_density, so depends on the results of all previous
+  // BTRANs. However, the result of a BTRAN only depends on the
+  // expected density via the style of solve chosen by HFactor. Hence
+  // each batch of BTRANs is performed in parallel with the expected
+  // density at the start of the batch, and row_ep_density is then
+  // updated serially. If this changes the style of solve, the batch
+  // is cut short, and the next starts with the BTRAN whose style
+  // would have differed, so the weights and row_ep_density are
+  // identical to those computed serially.
+  const HighsInt num_row = lp_.num_row_;
+  const HFactor& factor = simplex_nla_.factor_;
+  std::vector<HighsInt> row_ep_count(num_row);
+  const HighsInt batch_size = kParallelDseBatchSize * num_threads;
+  HighsInt from_row = 0;
+  while (from_row < num_row) {
+    const HighsInt to_row = std::min(from_row + batch_size, num_row);
+    const double expected_density = info_.row_ep_density;
+    highs::parallel::for_each(
+        from_row, to_row,
+        [&](HighsInt start, HighsInt end) {
+          // Each worker uses a row_ep from its own pool
+          PooledHVector pooled_row_ep(num_row);
+          HVector& local_row_ep = *pooled_row_ep;
+          for (HighsInt iRow = start; iRow < end; iRow++) {
+            dual_edge_weight_[iRow] = computeDualSteepestEdgeWeight(
+                iRow, local_row_ep, expected_density, nullptr);
+            row_ep_count[iRow] = local_row_ep.count;
+          }
+        },
+        16);
+    const HighsInt style = factor.btranStyle(expected_density);
+    HighsInt iRow = from_row;
+    for (; iRow < to_row; iRow++) {
+      if (factor.btranStyle(info_.row_ep_density) != style) break;
+      const double local_row_ep_density = (1.0 * row_ep_count[iRow]) / num_row;
+      updateOperationResultDensity(local_row_ep_density, info_.row_ep_density);
+    }
+    from_row = iRow;
+  }
+}
+
 double HEkk::computeDualSteepestEdgeWeight(const HighsInt iRow,
                                            HVector& row_ep) {
+  const double weight = computeDualSteepestEdgeWeight(
+      iRow, row_ep, info_.row_ep_density,
+      analysis_.pointer_serial_factor_clocks);
+  const double local_row_ep_density = (1.0 * row_ep.count) / lp_.num_row_;
+  updateOperationResultDensity(local_row_ep_density, info_.row_ep_density);
+  return weight;
+}
+
+double HEkk::computeDualSteepestEdgeWeight(
+    const HighsInt iRow, HVector& row_ep, const double expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
   row_ep.clear();
   row_ep.count = 1;
   row_ep.index[0] = iRow;
   row_ep.array[iRow] = 1;
   row_ep.packFlag = false;
-  simplex_nla_.btranInScaledSpace(row_ep, info_.row_ep_density,
-                                  analysis_.pointer_serial_factor_clocks);
-  const double local_row_ep_density = (1.0 * row_ep.count) / lp_.num_row_;
-  updateOperationResultDensity(local_row_ep_density, info_.row_ep_density);
+  simplex_nla_.btranInScaledSpace(row_ep, expected_density,
+                                  factor_timer_clock_pointer);
   return row_ep.norm2();
 }
 
@@ -2927,10 +2997,9 @@ void HEkk::computePrimal() {
   analysis_.simplexTimerStart(ComputePrimalClock);
   const HighsInt num_row = lp_.num_row_;
   const HighsInt num_col = lp_.num_col_;
-  // Setup a local buffer for the values of basic variables
-  HVector primal_col;
-  primal_col.setup(num_row);
-  primal_col.clear();
+  // Use a local buffer for the values of basic variables
+  PooledHVector pooled_primal_col(num_row);
+  HVector& primal_col = *pooled_primal_col;
   for (HighsInt i = 0; i < num_col + num_row; i++) {
     if (basis_.nonbasicFlag_[i] && info_.workValue_[i] != 0) {
       lp_.a_matrix_.collectAj(primal_col, i, info_.workValue_[i]);
@@ -2962,10 +3031,9 @@ void HEkk::computePrimal() {
 
 void HEkk::computeDual() {
   analysis_.simplexTimerStart(ComputeDualClock);
-  // Create a local buffer for the pi vector
-  HVector dual_col;
-  dual_col.setup(lp_.num_row_);
-  dual_col.clear();
+  // Use a local buffer for the pi vector
+  PooledHVector pooled_dual_col(lp_.num_row_);
+  HVector& dual_col = *pooled_dual_col;
   for (HighsInt iRow = 0; iRow < lp_.num_row_; iRow++) {
     const double value = info_.workCost_[basis_.basicIndex_[iRow]] +
                          info_.workShift_[basis_.basicIndex_[iRow]];
@@ -2987,9 +3055,9 @@ void HEkk::computeDual() {
 
   if (dual_col.count) {
     fullBtran(dual_col);
-    // Create a local buffer for the values of reduced costs
-    HVector dual_row;
-    dual_row.setup(lp_.num_col_);
+    // Use a local buffer for the values of reduced costs
+    PooledHVector pooled_dual_row(lp_.num_col_);
+    HVector& dual_row = *pooled_dual_row;
     fullPrice(dual_col, dual_row);
     for (HighsInt i = 0; i < lp_.num_col_; i++)
       info_.workDual_[i] -= dual_row.array[i];
@@ -3458,13 +3526,24 @@ bool HEkk::bailoutOnTimeIterations() {
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
-           model_status_ == HighsModelStatus::kObjectiveTarget);
+           model_status_ == HighsModelStatus::kObjectiveTarget ||
+           model_status_ == HighsModelStatus::kInterrupt);
   } else if (timer_->readRunHighsClock() > options_->time_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kTimeLimit;
+  } else if (race_timer_ &&
+             race_timer_->limitReached(timer_->readRunHighsClock())) {
+    // Another solver in the race has already finished
+    solve_bailout_ = true;
+    model_status_ = HighsModelStatus::kTimeLimit;
   } else if (iteration_count_ >= options_->simplex_iteration_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kIterationLimit;
+  } else if (stop_token_.stopRequested()) {
+    solve_bailout_ = true;
+    model_status_ = stop_token_.stopReason() == HighsStopReason::kDeadline
+                        ? HighsModelStatus::kTimeLimit
+                        : HighsModelStatus::kInterrupt;
   }
   return solve_bailout_;
 }
@@ -3491,7 +3570,8 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
-           model_status_ == HighsModelStatus::kObjectiveTarget);
+           model_status_ == HighsModelStatus::kObjectiveTarget ||
+           model_status_ == HighsModelStatus::kInterrupt);
   }
   // Check that returnFromSolve has not already been called: it should
   // be called exactly once per solve
@@ -3577,6 +3657,7 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     case HighsModelStatus::kObjectiveTarget:
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
+    case HighsModelStatus::kInterrupt:
     case HighsModelStatus::kUnknown: {
       // Simplex has failed to conclude a model property. Either it
       // has bailed out due to reaching the objecive bound, target,
@@ -3630,8 +3711,8 @@ double HEkk::computeBasisCondition() {
   vector<double> bs_cond_y;
   vector<double> bs_cond_z;
   vector<double> bs_cond_w;
-  HVector row_ep;
-  row_ep.setup(solver_num_row);
+  PooledHVector pooled_row_ep(solver_num_row);
+  HVector& row_ep = *pooled_row_ep;
 
   const HighsInt* Astart = lp_.a_matrix_.start_.data();
   const double* Avalue = lp_.a_matrix_.value_.data();
@@ -3832,6 +3913,158 @@ HighsStatus HEkk::getIterate() {
   return HighsStatus::kOk;
 }
 
+void HEkk::putFactorCache() {
+  const HighsInt cache_size = options_->simplex_factor_cache_size;
+  if (cache_size <= 0) {
+    clearFactorCache();
+    return;
+  }
+  if (!this->status_.has_invert) return;
+  const uint64_t matrix_hash = factorCacheMatrixHash();
+  // Use any entry for the same basis, otherwise add an entry if there
+  // is space, otherwise replace the least recently used entry
+  HighsInt use_entry = -1;
+  for (HighsInt iEntry = 0; iEntry < (HighsInt)factor_cache_.size();
+       iEntry++) {
+    FactorCacheEntry& entry = factor_cache_[iEntry];
+    if (entry.basis_hash_ == basis_.hash &&
+        entry.matrix_hash_ == matrix_hash) {
+      // The entry already holds a factorization of the basis in this
+      // order with as many updates, so keep it rather than copying
+      if (entry.update_count_ == info_.update_count &&
+          entry.basic_index_ == basis_.basicIndex_) {
+        entry.last_use_ = ++factor_cache_use_clock_;
+        return;
+      }
+      use_entry = iEntry;
+      break;
+    }
+  }
+  if (use_entry < 0) {
+    if ((HighsInt)factor_cache_.size() < cache_size) {
+      use_entry = factor_cache_.size();
+      factor_cache_.resize(use_entry + 1);
+    } else {
+      use_entry = 0;
+      for (HighsInt iEntry = 1; iEntry < (HighsInt)factor_cache_.size();
+           iEntry++)
+        if (factor_cache_[iEntry].last_use_ <
+            factor_cache_[use_entry].last_use_)
+          use_entry = iEntry;
+    }
+  }
+  FactorCacheEntry& entry = factor_cache_[use_entry];
+  entry.basis_hash_ = basis_.hash;
+  entry.matrix_hash_ = matrix_hash;
+  entry.last_use_ = ++factor_cache_use_clock_;
+  entry.update_count_ = info_.update_count;
+  entry.build_synthetic_tick_ = build_synthetic_tick_;
+  entry.total_synthetic_tick_ = total_synthetic_tick_;
+  entry.basic_index_ = basis_.basicIndex_;
+  entry.invert_ = simplex_nla_.factor_.getInvert();
+  if (this->status_.has_dual_steepest_edge_weights) {
+    entry.dual_edge_weight_ = this->dual_edge_weight_;
+  } else {
+    entry.dual_edge_weight_.clear();
+  }
+  // Drop any entries beyond a reduced cache size
+  while ((HighsInt)factor_cache_.size() > cache_size) {
+    HighsInt lru_entry = 0;
+    for (HighsInt iEntry = 1; iEntry < (HighsInt)factor_cache_.size();
+         iEntry++)
+      if (factor_cache_[iEntry].last_use_ <
+          factor_cache_[lru_entry].last_use_)
+        lru_entry = iEntry;
+    factor_cache_.erase(factor_cache_.begin() + lru_entry);
+  }
+}
+
+bool HEkk::getFactorCache() {
+  if (options_->simplex_factor_cache_size <= 0 || !factor_cache_.size())
+    return false;
+  const HighsInt num_row = lp_.num_row_;
+  const HighsInt num_tot = lp_.num_col_ + num_row;
+  uint64_t matrix_hash = 0;
+  bool have_matrix_hash = false;
+  for (FactorCacheEntry& entry : factor_cache_) {
+    if (entry.basis_hash_ != basis_.hash) continue;
+    if ((HighsInt)entry.basic_index_.size() != num_row) continue;
+    if (!have_matrix_hash) {
+      matrix_hash = factorCacheMatrixHash();
+      have_matrix_hash = true;
+    }
+    if (entry.matrix_hash_ != matrix_hash) continue;
+    // The basis hash is independent of the order of the basic
+    // variables, so check that each variable in the entry is basic
+    bool same_basis = true;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      const HighsInt iVar = entry.basic_index_[iRow];
+      if (iVar < 0 || iVar >= num_tot ||
+          basis_.nonbasicFlag_[iVar] != kNonbasicFlagFalse) {
+        same_basis = false;
+        break;
+      }
+    }
+    if (!same_basis) continue;
+    // Use the order of the basic variables corresponding to the
+    // invertible representation
+    std::copy(entry.basic_index_.begin(), entry.basic_index_.end(),
+              basis_.basicIndex_.begin());
+    simplex_nla_.factor_.setInvert(entry.invert_);
+    simplex_nla_.frozenBasisClearAllUpdate();
+    if (entry.dual_edge_weight_.size()) {
+      this->dual_edge_weight_ = entry.dual_edge_weight_;
+      this->scattered_dual_edge_weight_.resize(num_tot);
+      this->status_.has_dual_steepest_edge_weights = true;
+    }
+    info_.update_count = entry.update_count_;
+    // Restore the synthetic clock of the cached INVERT and its updates
+    build_synthetic_tick_ = entry.build_synthetic_tick_;
+    total_synthetic_tick_ = entry.total_synthetic_tick_;
+    status_.has_invert = true;
+    status_.has_fresh_invert = entry.update_count_ == 0;
+    entry.last_use_ = ++factor_cache_use_clock_;
+    factor_cache_num_hit_++;
+    highsLogDev(options_->log_options, HighsLogType::kInfo,
+                "Using cached factorization of basis with %" HIGHSINT_FORMAT
+                " updates%s\n",
+                entry.update_count_,
+                entry.dual_edge_weight_.size() ? " and dual edge weights"
+                                                : "");
+    return true;
+  }
+  return false;
+}
+
+void HEkk::clearFactorCache() {
+  factor_cache_.clear();
+  factor_cache_use_clock_ = 0;
+}
+
+uint64_t HEkk::factorCacheMatrixHash() const {
+  // Hash the scaled constraint matrix that is factored, whether or
+  // not the LP is currently scaled
+  const HighsSparseMatrix& a_matrix = lp_.a_matrix_;
+  assert(a_matrix.isColwise());
+  const HighsInt num_nz = a_matrix.numNz();
+  std::vector<double> value(a_matrix.value_.begin(),
+                            a_matrix.value_.begin() + num_nz);
+  if (lp_.scale_.has_scaling && !lp_.is_scaled_) {
+    for (HighsInt iCol = 0; iCol < lp_.num_col_; iCol++)
+      for (HighsInt iEl = a_matrix.start_[iCol];
+           iEl < a_matrix.start_[iCol + 1]; iEl++)
+        value[iEl] *= (lp_.scale_.col[iCol] *
+                       lp_.scale_.row[a_matrix.index_[iEl]]);
+  }
+  std::vector<uint64_t> hash = {
+      (uint64_t)lp_.num_col_, (uint64_t)lp_.num_row_,
+      HighsHashHelpers::vector_hash(a_matrix.start_.data(),
+                                    lp_.num_col_ + 1),
+      HighsHashHelpers::vector_hash(a_matrix.index_.data(), num_nz),
+      HighsHashHelpers::vector_hash(value.data(), num_nz)};
+  return HighsHashHelpers::vector_hash(hash.data(), hash.size());
+}
+
 double HEkk::factorSolveError() {
   // Cheap assessment of factor accuracy.
   //
@@ -3842,10 +4075,10 @@ double HEkk::factorSolveError() {
   const HighsSparseMatrix& a_matrix = this->lp_.a_matrix_;
   const vector<HighsInt>& basic_index = this->basis_.basicIndex_;
   const HighsSparseMatrix& ar_matrix = this->ar_matrix_;
-  HVector btran_rhs;
-  HVector ftran_rhs;
-  btran_rhs.setup(num_row);
-  ftran_rhs.setup(num_row);
+  PooledHVector pooled_btran_rhs(num_row);
+  PooledHVector pooled_ftran_rhs(num_row);
+  HVector& btran_rhs = *pooled_btran_rhs;
+  HVector& ftran_rhs = *pooled_ftran_rhs;
 
   // Solve for a random solution
   HighsRandom random(1);
@@ -4054,8 +4287,8 @@ bool HEkk::proofOfPrimalInfeasibility() {
   HighsInt move_out = info_.dual_ray_sign_;
   HighsInt row_out = info_.dual_ray_row_;
   // Compute the basis inverse row
-  HVector row_ep;
-  row_ep.setup(lp.num_row_);
+  PooledHVector pooled_row_ep(lp.num_row_);
+  HVector& row_ep = *pooled_row_ep;
   unitBtran(row_out, row_ep);
   return proofOfPrimalInfeasibility(row_ep, move_out, row_out);
 }
@@ -4277,11 +4510,11 @@ void HEkk::unitBtranIterativeRefinement(const HighsInt row_out,
                                         HVector& row_ep) {
   // Perform an iteration of refinement
   HighsLp& lp = this->lp_;
-  HVector residual;
+  PooledHVector pooled_residual(lp.num_row_);
+  HVector& residual = *pooled_residual;
   double residual_norm = 0;
   double correction_norm = 0;
   const double expected_density = 1;
-  residual.setup(lp.num_row_);
   unitBtranResidual(row_out, row_ep, residual, residual_norm);
   const bool debug_iterative_refinement_report_on = false;
   bool debug_iterative_refinement_report = false;
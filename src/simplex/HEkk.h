@@ -14,6 +14,8 @@
 #ifndef SIMPLEX_HEKK_H_
 #define SIMPLEX_HEKK_H_
 
+#include "parallel/HighsRaceTimer.h"
+#include "parallel/HighsStopToken.h"
 #include "simplex/HSimplexNla.h"
 #include "simplex/HighsSimplexAnalysis.h"
 #include "util/HSet.h"
@@ -76,6 +78,11 @@ class HEkk {
   void putIterate();
   HighsStatus getIterate();
 
+  void putFactorCache();
+  bool getFactorCache();
+  void clearFactorCache();
+  uint64_t factorCacheMatrixHash() const;
+
   void addCols(const HighsLp& lp, const HighsSparseMatrix& scaled_a_matrix);
   void addRows(const HighsLp& lp, const HighsSparseMatrix& scaled_ar_matrix);
   void deleteCols(const HighsIndexCollection& index_collection);
@@ -133,6 +140,12 @@ class HEkk {
   // Data members
   HighsOptions* options_;
   HighsTimer* timer_;
+  // Set when racing other LP solvers, so that the solve stops once
+  // another solver has finished
+  HighsRaceTimer<double>* race_timer_ = nullptr;
+  // Raised when the solve should stop early, for example because it
+  // runs in a task that has been cancelled
+  HighsStopToken stop_token_;
   HighsSimplexAnalysis analysis_;
 
   HighsLp lp_;
@@ -152,6 +165,15 @@ class HEkk {
   HSimplexNla simplex_nla_;
   HotStart hot_start_;
 
+  // Invertible representations and dual edge weights of bases at the
+  // end of previous solves, retained so that INVERT is avoided when a
+  // solve starts from one of them. Not cleared with the rest of Ekk
+  // since entries are only used if the (scaled) constraint matrix is
+  // unchanged
+  std::vector<FactorCacheEntry> factor_cache_;
+  HighsInt factor_cache_use_clock_ = 0;
+  HighsInt factor_cache_num_hit_ = 0;
+
   double cost_scale_ = 1;
   double cost_perturbation_base_;
   double cost_perturbation_max_abs_cost_;
@@ -225,7 +247,11 @@ class HEkk {
   bool rebuildRefactor(HighsInt rebuild_reason);
   HighsInt computeFactor();
   void computeDualSteepestEdgeWeights(const bool initial = false);
+  void computeDualSteepestEdgeWeightsParallel(const HighsInt num_threads);
   double computeDualSteepestEdgeWeight(const HighsInt iRow, HVector& row_ep);
+  double computeDualSteepestEdgeWeight(
+      const HighsInt iRow, HVector& row_ep, const double expected_density,
+      HighsTimerClock* factor_timer_clock_pointer) const;
   void updateDualSteepestEdgeWeights(const HighsInt row_out,
                                      const HighsInt variable_in,
                                      const HVector* column,
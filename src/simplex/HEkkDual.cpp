@@ -25,6 +25,7 @@
 #include "parallel/HighsParallel.h"
 #include "simplex/HEkkPrimal.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HVectorPool.h"
 
 using std::fabs;
 
@@ -546,6 +547,47 @@ void HEkkDual::initSlice(const HighsInt initial_num_slice) {
   }
 }
 
+void HEkkDual::initialiseSlicePrice() {
+  slice_price = false;
+  if (!ekk_instance_.options_->simplex_parallel_price) return;
+  const HighsInt num_threads = highs::parallel::num_threads();
+  if (num_threads < 2) return;
+  const HighsInt num_slice = std::min(num_threads, kHighsSlicedLimit);
+  for (HighsInt i = 0; i < num_slice; i++)
+    slice_dualRow.push_back(HEkkDualRow(ekk_instance_));
+  initSlice(num_slice);
+  // The row-wise slices are partitioned in rebuild()
+  slice_price = slice_num > 1;
+}
+
+void HEkkDual::partitionSliceMatrix() {
+  const int8_t* nonbasicFlag = ekk_instance_.basis_.nonbasicFlag_.data();
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++)
+      slice_ar_matrix[i].createRowwisePartitioned(
+          slice_a_matrix[i], nonbasicFlag + slice_start[i]);
+  });
+}
+
+void HEkkDual::updateSliceMatrix() {
+  for (HighsInt i = 0; i < slice_num; i++) {
+    // Variables outside the slice are given the local index
+    // slice_num_col, so that HighsSparseMatrix::update ignores them
+    const HighsInt from_col = slice_start[i];
+    const HighsInt slice_num_col = slice_start[i + 1] - from_col;
+    const HighsInt slice_in =
+        variable_in >= from_col && variable_in < slice_start[i + 1]
+            ? variable_in - from_col
+            : slice_num_col;
+    const HighsInt slice_out =
+        variable_out >= from_col && variable_out < slice_start[i + 1]
+            ? variable_out - from_col
+            : slice_num_col;
+    if (slice_in == slice_num_col && slice_out == slice_num_col) continue;
+    slice_ar_matrix[i].update(slice_in, slice_out, slice_a_matrix[i]);
+  }
+}
+
 void HEkkDual::initialiseSolve() {
   // Copy values of simplex solver options to dual simplex options
   primal_feasibility_tolerance =
@@ -1040,6 +1082,9 @@ void HEkkDual::rebuild() {
     assert(ekk_instance_.ar_matrix_.debugPartitionOk(
         ekk_instance_.basis_.nonbasicFlag_.data()));
   }
+  // The basis may have changed since the row-wise slices were last
+  // partitioned, for example when backtracking
+  if (slice_price) partitionSliceMatrix();
   // Record whether the update objective value should be tested. If
   // the objective value is known, then the updated objective value
   // should be correct - once the correction due to recomputing the
@@ -1202,14 +1247,10 @@ void HEkkDual::iterate() {
   if (isBadBasisChange()) return;
 
   analysis->simplexTimerStart(IterateFtranClock);
-  updateFtranBFRT();
-
-  // updateFtran(); computes the pivotal column in the data structure "column"
-  updateFtran();
-
-  // updateFtranDSE performs the DSE FTRAN on pi_p
-  if (edge_weight_mode == EdgeWeightMode::kSteepestEdge)
-    updateFtranDSE(&row_ep);
+  // updateFtranMulti(); performs the BFRT FTRAN, computes the pivotal
+  // column in the data structure "column" and, when using DSE,
+  // performs the DSE FTRAN on pi_p
+  updateFtranMulti();
   analysis->simplexTimerStop(IterateFtranClock);
 
   // updateVerify() Checks row-wise pivot against column-wise pivot for
@@ -1557,10 +1598,16 @@ void HEkkDual::chooseColumn(HVector* row_ep) {
   // PRICE
   //
   const bool quad_precision = false;
-  ekk_instance_.tableauRowPrice(quad_precision, *row_ep, row_ap,
-                                debug_price_report);
+  bool row_ap_in_slices = false;
+  if (slice_price) {
+    row_ap_in_slices = tableauRowPriceSlice(*row_ep, debug_price_report);
+  } else {
+    ekk_instance_.tableauRowPrice(quad_precision, *row_ep, row_ap,
+                                  debug_price_report);
+  }
   if (debug_rows_report) {
-    ekk_instance_.simplex_nla_.reportArray("Row a_p", 0, &row_ap, true);
+    if (!row_ap_in_slices)
+      ekk_instance_.simplex_nla_.reportArray("Row a_p", 0, &row_ap, true);
     ekk_instance_.simplex_nla_.reportArray("Row e_p", lp.num_col_, row_ep,
                                            true);
   }
@@ -1578,8 +1625,14 @@ void HEkkDual::chooseColumn(HVector* row_ep) {
   //
   // Section 1: Pack row_ap and row_ep
   analysis->simplexTimerStart(Chuzc1Clock);
-  // Pack row_ap into the packIndex/Value of HEkkDualRow
-  dualRow.chooseMakepack(&row_ap, 0);
+  // Pack row_ap into the packIndex/Value of HEkkDualRow. Packing the
+  // slices in order gives the same packIndex/Value as packing row_ap
+  if (row_ap_in_slices) {
+    for (HighsInt i = 0; i < slice_num; i++)
+      dualRow.chooseMakepack(&slice_row_ap[i], slice_start[i]);
+  } else {
+    dualRow.chooseMakepack(&row_ap, 0);
+  }
   // Pack row_ep into the packIndex/Value of HEkkDualRow
   dualRow.chooseMakepack(row_ep, solver_num_col);
   const double row_ep_scale =
@@ -1926,6 +1979,92 @@ void HEkkDual::chooseColumnSlice(HVector* row_ep) {
   }
 }
 
+bool HEkkDual::tableauRowPriceSlice(const HVector& row_ep,
+                                    const HighsInt debug_report) {
+  // Only standard row-wise PRICE and column-wise PRICE are performed
+  // over the slices. Each component of the pivot row is accumulated
+  // in the same order as in HEkk::tableauRowPrice, so its value is
+  // the same, and the slices are packed in order of increasing column
+  // index, as is row_ap after standard PRICE
+  HighsSimplexInfo& info = ekk_instance_.info_;
+  const double local_density = 1.0 * row_ep.count / solver_num_row;
+  bool use_col_price;
+  bool use_row_price_w_switch;
+  ekk_instance_.choosePriceTechnique(info.price_strategy, local_density,
+                                     use_col_price, use_row_price_w_switch);
+  if (!use_col_price && !use_row_price_w_switch) {
+    // Hyper-sparse row-wise PRICE never switches to standard PRICE
+    const bool quad_precision = false;
+    ekk_instance_.tableauRowPrice(quad_precision, row_ep, row_ap,
+                                  debug_report);
+    return false;
+  }
+  analysis->simplexTimerStart(PriceClock);
+  if (analysis->analyse_simplex_summary_data) {
+    if (use_col_price) {
+      const double expected_density = 1;
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      expected_density);
+      analysis->num_col_price++;
+    } else {
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      info.row_ep_density);
+      analysis->num_row_price_with_switch++;
+    }
+  }
+  row_ap.clear();
+  HighsInt next_index = 0;
+  if (!use_col_price) {
+    // Perform hyper-sparse row-wise PRICE until it would switch to
+    // standard row-wise PRICE
+    next_index = ekk_instance_.ar_matrix_.priceByRowSparseResultWithSwitch(
+        row_ap, row_ep, info.row_ap_density, 0, kHyperPriceDensity,
+        debug_report);
+  }
+  const bool use_slices = use_col_price || next_index < row_ep.count;
+  HighsInt row_ap_count;
+  if (use_slices) {
+    const int8_t* nonbasicFlag = ekk_instance_.basis_.nonbasicFlag_.data();
+    highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+      const bool quad_precision = false;
+      for (HighsInt i = start; i < end; i++) {
+        const HighsInt from_col = slice_start[i];
+        const HighsInt slice_num_col = slice_start[i + 1] - from_col;
+        if (use_col_price) {
+          slice_row_ap[i].clear();
+          slice_a_matrix[i].priceByColumn(quad_precision, slice_row_ap[i],
+                                          row_ep);
+          // Zero the components corresponding to basic variables
+          for (HighsInt iCol = 0; iCol < slice_num_col; iCol++)
+            slice_row_ap[i].array[iCol] *= nonbasicFlag[from_col + iCol];
+        } else {
+          // Continue from the values of hyper-sparse row-wise PRICE
+          std::copy(row_ap.array.begin() + from_col,
+                    row_ap.array.begin() + from_col + slice_num_col,
+                    slice_row_ap[i].array.begin());
+          slice_ar_matrix[i].priceByRowDenseResult(slice_row_ap[i], row_ep,
+                                                   next_index);
+        }
+      }
+    });
+    row_ap_count = 0;
+    for (HighsInt i = 0; i < slice_num; i++)
+      row_ap_count += slice_row_ap[i].count;
+  } else {
+    // Hyper-sparse row-wise PRICE is complete, so remove small values
+    row_ap.tight();
+    row_ap_count = row_ap.count;
+  }
+  // Update the record of average row_ap density
+  const double local_row_ap_density = (double)row_ap_count / solver_num_col;
+  ekk_instance_.updateOperationResultDensity(local_row_ap_density,
+                                             info.row_ap_density);
+  if (analysis->analyse_simplex_summary_data)
+    analysis->operationRecordAfter(kSimplexNlaPriceAp, row_ap_count);
+  analysis->simplexTimerStop(PriceClock);
+  return use_slices;
+}
+
 void HEkkDual::updateFtran() {
   // Compute the pivotal column (FTRAN)
   //
@@ -2033,6 +2172,79 @@ void HEkkDual::updateFtranDSE(HVector* DSE_Vector) {
       local_row_DSE_density, ekk_instance_.info_.row_DSE_density);
 }
 
+void HEkkDual::updateFtranMulti() {
+  // Perform the FTRANs of updateFtranBFRT, updateFtran and
+  // updateFtranDSE with one call to HFactor::ftranMulti, so that the
+  // factors are streamed from memory once rather than three times.
+  // The results are identical to the separate FTRANs, but they are
+  // all timed by FtranClock
+  //
+  // If reinversion is needed then skip this method
+  if (rebuild_reason) return;
+  analysis->simplexTimerStart(FtranClock);
+  const bool analyse = analysis->analyse_simplex_summary_data;
+  const bool ftran_dse = edge_weight_mode == EdgeWeightMode::kSteepestEdge;
+  HighsSimplexInfo& info = ekk_instance_.info_;
+  HVector* rhs[3];
+  double expected_density[3];
+  HighsInt num_rhs = 0;
+  // The RHS changes corresponding to the BFRT. If dualRow.workCount =
+  // 0 then dualRow.updateFlip(&col_BFRT) merely clears col_BFRT
+  dualRow.updateFlip(&col_BFRT);
+  const bool ftran_col_BFRT = col_BFRT.count > 0;
+  if (ftran_col_BFRT) {
+    if (analyse)
+      analysis->operationRecordBefore(kSimplexNlaFtranBfrt, col_BFRT,
+                                      info.col_BFRT_density);
+    simplex_nla->applyBasisMatrixRowScale(col_BFRT);
+    rhs[num_rhs] = &col_BFRT;
+    expected_density[num_rhs++] = info.col_BFRT_density;
+  }
+  // The pivotal column
+  col_aq.clear();
+  col_aq.packFlag = true;
+  a_matrix->collectAj(col_aq, variable_in, 1);
+  if (analyse)
+    analysis->operationRecordBefore(kSimplexNlaFtran, col_aq,
+                                    info.col_aq_density);
+  simplex_nla->applyBasisMatrixRowScale(col_aq);
+  rhs[num_rhs] = &col_aq;
+  expected_density[num_rhs++] = info.col_aq_density;
+  // The DSE vector: see updateFtranDSE for the scaling actions
+  if (ftran_dse) {
+    if (analyse)
+      analysis->operationRecordBefore(kSimplexNlaFtranDse, row_ep,
+                                      info.row_DSE_density);
+    simplex_nla->unapplyBasisMatrixRowScale(row_ep);
+    rhs[num_rhs] = &row_ep;
+    expected_density[num_rhs++] = info.row_DSE_density;
+  }
+
+  simplex_nla->ftranInScaledSpace(rhs, num_rhs, expected_density,
+                                  analysis->pointer_serial_factor_clocks);
+
+  if (ftran_col_BFRT) {
+    simplex_nla->applyBasisMatrixColScale(col_BFRT);
+    if (analyse) analysis->operationRecordAfter(kSimplexNlaFtranBfrt, col_BFRT);
+  }
+  ekk_instance_.updateOperationResultDensity(
+      (double)col_BFRT.count / solver_num_row, info.col_BFRT_density);
+
+  simplex_nla->applyBasisMatrixColScale(col_aq);
+  if (analyse) analysis->operationRecordAfter(kSimplexNlaFtran, col_aq);
+  ekk_instance_.updateOperationResultDensity(
+      (double)col_aq.count / solver_num_row, info.col_aq_density);
+  // Save the pivot value computed column-wise - used for numerical checking
+  alpha_col = col_aq.array[row_out];
+
+  if (ftran_dse) {
+    if (analyse) analysis->operationRecordAfter(kSimplexNlaFtranDse, row_ep);
+    ekk_instance_.updateOperationResultDensity(
+        (double)row_ep.count / solver_num_row, info.row_DSE_density);
+  }
+  analysis->simplexTimerStop(FtranClock);
+}
+
 void HEkkDual::updateVerify() {
   // Compare the pivot value computed row-wise and column-wise and
   // determine whether reinversion is advisable
@@ -2232,6 +2444,7 @@ void HEkkDual::updatePivots() {
   //
   // Update the row-wise representation of the nonbasic columns
   ekk_instance_.updateMatrix(variable_in, variable_out);
+  if (slice_price) updateSliceMatrix();
   //
   // Delete Freelist entry for variable_in
   dualRow.deleteFreelist(variable_in);
@@ -2752,7 +2965,8 @@ bool HEkkDual::bailoutOnDualObjective() {
     // reasons
     assert(ekk_instance_.model_status_ == HighsModelStatus::kTimeLimit ||
            ekk_instance_.model_status_ == HighsModelStatus::kIterationLimit ||
-           ekk_instance_.model_status_ == HighsModelStatus::kObjectiveBound);
+           ekk_instance_.model_status_ == HighsModelStatus::kObjectiveBound ||
+           ekk_instance_.model_status_ == HighsModelStatus::kInterrupt);
   } else if (ekk_instance_.lp_.sense_ == ObjSense::kMinimize &&
              solve_phase == kSolvePhase2) {
     if (ekk_instance_.info_.updated_dual_objective_value >
@@ -2784,8 +2998,10 @@ bool HEkkDual::reachedExactObjectiveBound() {
         ekk_instance_.info_.updated_dual_objective_value;
     const double perturbed_value_residual =
         perturbed_dual_objective_value - objective_bound;
-    HVector dual_col;
-    HVector dual_row;
+    PooledHVector pooled_dual_col(solver_num_row);
+    PooledHVector pooled_dual_row(solver_num_col);
+    HVector& dual_col = *pooled_dual_col;
+    HVector& dual_row = *pooled_dual_row;
     const double exact_dual_objective_value =
         computeExactDualObjectiveValue(dual_col, dual_row);
     const double exact_value_residual =
@@ -2839,8 +3055,10 @@ double HEkkDual::computeExactDualObjectiveValue(HVector& dual_col,
   const HighsLp& lp = ekk_instance_.lp_;
   const SimplexBasis& basis = ekk_instance_.basis_;
   const HighsSimplexInfo& info = ekk_instance_.info_;
-  // Create a local buffer for the pi vector
-  dual_col.setup(lp.num_row_);
+  // The buffers for the pi vector and dual vector are set up by the
+  // caller
+  assert(dual_col.size == lp.num_row_);
+  assert(dual_row.size == lp.num_col_);
   dual_col.clear();
   for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
     HighsInt iVar = basis.basicIndex_[iRow];
@@ -2852,9 +3070,7 @@ double HEkkDual::computeExactDualObjectiveValue(HVector& dual_col,
       }
     }
   }
-  // Create a local buffer for the dual vector
   const HighsInt numTot = lp.num_col_ + lp.num_row_;
-  dual_row.setup(lp.num_col_);
   dual_row.clear();
   if (dual_col.count) {
     const bool quad_precision = false;
@@ -41,7 +41,9 @@ class HEkkDual {
     initialiseInstance();
     dualRow.setup();
     dualRHS.setup();
-    if (!(ekk_instance_.info_.simplex_strategy == kSimplexStrategyDualPlain))
+    if (ekk_instance_.info_.simplex_strategy == kSimplexStrategyDualPlain)
+      initialiseSlicePrice();
+    else
       initialiseInstanceParallel(simplex);
   }
 
@@ -82,6 +84,25 @@ class HEkkDual {
                                       //!< is modified in light of limits
   );
 
+  /**
+   * @brief Initialise matrix slices so that serial dual simplex can
+   * perform PRICE in parallel, if simplex_parallel_price is set and
+   * there is more than one thread
+   */
+  void initialiseSlicePrice();
+
+  /**
+   * @brief Partition the row-wise slices of the matrix into nonbasic
+   * and basic columns
+   */
+  void partitionSliceMatrix();
+
+  /**
+   * @brief Update the partitioned row-wise slices of the matrix after a
+   * basis change
+   */
+  void updateSliceMatrix();
+
   /**
    * @brief Initialise a dual simplex solve
    */
@@ -200,6 +221,14 @@ class HEkkDual {
    */
   void chooseColumnSlice(HVector* row_ep);
 
+  /**
+   * @brief Compute pivot row (PRICE) as HEkk::tableauRowPrice, but
+   * performing standard PRICE in parallel over the column slices.
+   * Returns true if the pivot row is in slice_row_ap rather than row_ap
+   */
+  bool tableauRowPriceSlice(const HVector& row_ep,
+                            const HighsInt debug_report);
+
   /**
    * @brief Compute the pivotal column (FTRAN)
    */
@@ -217,6 +246,13 @@ class HEkkDual {
    */
   void updateFtranDSE(HVector* DSE_Vector  //!< Pivotal column as RHS for FTRAN
   );
+
+  /**
+   * @brief Perform FTRAN-BFRT, the FTRAN of the pivotal column and
+   * (when using DSE) FTRAN-DSE on row_ep in one pass over the factors
+   */
+  void updateFtranMulti();
+
   /**
    * @brief Compare the pivot value computed row-wise and column-wise
    * and determine whether reinversion is advisable
@@ -464,6 +500,8 @@ class HEkkDual {
   HighsSparseMatrix slice_ar_matrix[kHighsSlicedLimit];
   HVector slice_row_ap[kHighsSlicedLimit];
   std::vector<HEkkDualRow> slice_dualRow;
+  // Whether serial dual simplex performs PRICE over the slices
+  bool slice_price = false;
 
   /**
    * @brief Multiple CHUZR data
@@ -20,6 +20,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsCDouble.h"
+#include "util/HighsSimd.h"
 #include "util/HighsSort.h"
 
 using std::make_pair;
@@ -39,8 +40,11 @@ void HEkkDualRow::setupSlice(HighsInt size) {
   packIndex.resize(workSize);
   packValue.resize(workSize);
 
+  packPossible.resize(workSize);
+
   workCount = 0;
   workData.resize(workSize);
+  workTight.resize(workSize);
   analysis = &ekk_instance_.analysis_;
 }
 
@@ -93,15 +97,19 @@ void HEkkDualRow::choosePossible() {
   workTheta = kHighsInf;
   workCount = 0;
 
-  for (HighsInt i = 0; i < packCount; i++) {
+  // First pass: identify the candidates
+  const HighsInt possibleCount =
+      highsSimdSelectPossible(packCount, packIndex.data(), packValue.data(),
+                              workMove, move_out, Ta, packPossible.data());
+  // Second pass: determine the Harris bound on the step
+  for (HighsInt k = 0; k < possibleCount; k++) {
+    const HighsInt i = packPossible[k];
     const HighsInt iCol = packIndex[i];
     const HighsInt move = workMove[iCol];
     const double alpha = packValue[i] * move_out * move;
-    if (alpha > Ta) {
-      workData[workCount++] = make_pair(iCol, alpha);
-      const double relax = workDual[iCol] * move + Td;
-      if (workTheta * alpha > relax) workTheta = relax / alpha;
-    }
+    workData[workCount++] = make_pair(iCol, alpha);
+    const double relax = workDual[iCol] * move + Td;
+    if (workTheta * alpha > relax) workTheta = relax / alpha;
   }
 }
 
@@ -144,11 +152,14 @@ HighsInt HEkkDualRow::chooseFinal() {
   const double totalDelta = fabs(workDelta);
   double selectTheta = 10 * workTheta + 1e-7;
   for (;;) {
+    // Entries beyond i are not moved before they are tested, so their
+    // breakpoints can be tested in advance
+    highsSimdBreakpointTight(workCount, fullCount, workData.data(), workMove,
+                             workDual, selectTheta, workTight.data());
     for (HighsInt i = workCount; i < fullCount; i++) {
       HighsInt iCol = workData[i].first;
       double alpha = workData[i].second;
-      double tight = workMove[iCol] * workDual[iCol];
-      if (alpha * selectTheta >= tight) {
+      if (workTight[i]) {
         swap(workData[workCount++], workData[i]);
         totalChange += workRange[iCol] * alpha;
       }
@@ -335,16 +346,18 @@ bool HEkkDualRow::chooseFinalWorkGroupQuad() {
     double remainTheta = kInitialRemainTheta;
     debug_num_loop++;
     HighsInt debug_loop_ln = 0;
+    highsSimdBreakpointTight(workCount, fullCount, workData.data(), workMove,
+                             workDual, selectTheta, workTight.data());
     for (HighsInt i = workCount; i < fullCount; i++) {
       HighsInt iCol = workData[i].first;
       double value = workData[i].second;
-      double dual = workMove[iCol] * workDual[iCol];
       // Tight satisfy
-      if (dual <= selectTheta * value) {
+      if (workTight[i]) {
         swap(workData[workCount++], workData[i]);
         totalChange += value * (workRange[iCol]);
-      } else if (dual + Td < remainTheta * value) {
-        remainTheta = (dual + Td) / value;
+      } else {
+        double dual = workMove[iCol] * workDual[iCol];
+        if (dual + Td < remainTheta * value) remainTheta = (dual + Td) / value;
       }
       debug_loop_ln++;
     }
@@ -560,18 +573,11 @@ void HEkkDualRow::updateFlip(HVector* bfrtColumn) {
 void HEkkDualRow::updateDual(double theta) {
   analysis->simplexTimerStart(UpdateDualClock);
   double* workDual = ekk_instance_.info_.workDual_.data();
-  double dual_objective_value_change = 0;
-  for (HighsInt i = 0; i < packCount; i++) {
-    workDual[packIndex[i]] -= theta * packValue[i];
-    // Identify the change to the dual objective
-    HighsInt iCol = packIndex[i];
-    const double delta_dual = theta * packValue[i];
-    const double local_value = ekk_instance_.info_.workValue_[iCol];
-    double local_dual_objective_change =
-        ekk_instance_.basis_.nonbasicFlag_[iCol] * (-local_value * delta_dual);
-    local_dual_objective_change *= ekk_instance_.cost_scale_;
-    dual_objective_value_change += local_dual_objective_change;
-  }
+  // Update the duals and identify the change to the dual objective
+  const double dual_objective_value_change = highsSimdUpdateDual(
+      packCount, packIndex.data(), packValue.data(), theta, workDual,
+      ekk_instance_.info_.workValue_.data(),
+      ekk_instance_.basis_.nonbasicFlag_.data(), ekk_instance_.cost_scale_);
   ekk_instance_.info_.updated_dual_objective_value +=
       dual_objective_value_change;
   analysis->simplexTimerStop(UpdateDualClock);
@@ -176,6 +176,8 @@ class HEkkDualRow {
   HighsInt packCount = 0;           //!< number of packed indices/values
   std::vector<HighsInt> packIndex;  //!< Packed indices
   std::vector<double> packValue;    //!< Packed values
+  std::vector<HighsInt>
+      packPossible;  //!< Positions in the pack of the CHUZC candidates
 
   // (Local) value of computed weight
   double computed_edge_weight = 0.;
@@ -191,6 +193,8 @@ class HEkkDualRow {
       workData;  //!< Index-Value pairs for ratio test
   std::vector<HighsInt>
       workGroup;  //!< Pointers into workData for degenerate nodes in BFRT
+  std::vector<int8_t>
+      workTight;  //!< Whether the breakpoints in workData are reached
 
   // Independent identifiers for heap-based sort in BFRT
   HighsInt alt_workCount = 0;
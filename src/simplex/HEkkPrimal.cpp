@@ -16,6 +16,7 @@
 #include "pdqsort/pdqsort.h"
 #include "simplex/HEkkDual.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HVectorPool.h"
 #include "util/HighsSort.h"
 
 using std::min;
@@ -1785,10 +1786,8 @@ void HEkkPrimal::phase1ComputeDual() {
   HighsSimplexInfo& info = ekk_instance_.info_;
   const vector<int8_t>& nonbasicFlag = ekk_instance_.basis_.nonbasicFlag_;
 
-  HVector buffer;
-  buffer.setup(num_row);
-  buffer.clear();
-  buffer.count = 0;
+  PooledHVector pooled_buffer(num_row);
+  HVector& buffer = *pooled_buffer;
   // Accumulate costs for checking
   info.workCost_.assign(num_tot, 0);
   // Zero the dual values
@@ -2332,8 +2331,8 @@ void HEkkPrimal::computePrimalSteepestEdgeWeights() {
         edge_weight_[iCol] += a_matrix.value_[iEl] * a_matrix.value_[iEl];
     }
   } else {
-    HVector local_col_aq;
-    local_col_aq.setup(num_row);
+    PooledHVector pooled_col_aq(num_row);
+    HVector& local_col_aq = *pooled_col_aq;
     for (HighsInt iVar = 0; iVar < num_tot; iVar++) {
       if (ekk_instance_.basis_.nonbasicFlag_[iVar]) {
         edge_weight_[iVar] =
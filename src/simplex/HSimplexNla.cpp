@@ -23,24 +23,26 @@
 
 using std::vector;
 
-void HSimplexNla::setup(const HighsLp* lp, HighsInt* basic_index,
-                        const HighsOptions* options, HighsTimer* timer,
-                        HighsSimplexAnalysis* analysis,
-                        const HighsSparseMatrix* factor_a_matrix,
-                        const double factor_pivot_threshold) {
+HighsInt HSimplexNla::setup(const HighsLp* lp, HighsInt* basic_index,
+                            const HighsOptions* options, HighsTimer* timer,
+                            HighsSimplexAnalysis* analysis,
+                            const HighsSparseMatrix* factor_a_matrix,
+                            const double factor_pivot_threshold) {
   this->setLpAndScalePointers(lp);
   this->basic_index_ = basic_index;
   this->options_ = options;
   this->timer_ = timer;
   this->analysis_ = analysis;
   this->report_ = false;
-  this->factor_.setupGeneral(
+  const HighsInt setup_return = this->factor_.setupGeneral(
       this->lp_->num_col_, this->lp_->num_row_, this->lp_->num_row_,
       factor_a_matrix->start_.data(), factor_a_matrix->index_.data(),
       factor_a_matrix->value_.data(), this->basic_index_,
       factor_pivot_threshold, this->options_->factor_pivot_tolerance,
       this->options_->highs_debug_level, &(this->options_->log_options));
+  if (setup_return) return setup_return;
   assert(debugCheckData("After HSimplexNla::setup") == HighsDebugStatus::kOk);
+  return 0;
 }
 
 void HSimplexNla::setLpAndScalePointers(const HighsLp* for_lp) {
@@ -90,6 +92,7 @@ HighsInt HSimplexNla::invert() {
     factor_timer_clock_pointer =
         analysis_->getThreadFactorTimerClockPtr(thread_id);
   }
+  factor_.setParallelTran(options_->simplex_parallel_tran);
   HighsInt rank_deficiency = factor_.build(factor_timer_clock_pointer);
   // Must not have timed out
   assert(rank_deficiency >= 0);
@@ -127,6 +130,14 @@ void HSimplexNla::ftranInScaledSpace(
   frozenFtran(rhs);
 }
 
+void HSimplexNla::ftranInScaledSpace(
+    HVector* const* rhs, const HighsInt num_rhs, const double* expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  factor_.ftranMulti(rhs, num_rhs, expected_density,
+                     factor_timer_clock_pointer);
+  for (HighsInt iRhs = 0; iRhs < num_rhs; iRhs++) frozenFtran(*rhs[iRhs]);
+}
+
 void HSimplexNla::frozenBtran(HVector& rhs) const {
   HighsInt frozen_basis_id = last_frozen_basis_id_;
   if (frozen_basis_id == kNoLink) return;
@@ -58,13 +58,25 @@ struct SimplexIterate {
   void clear();
 };
 
+struct FactorCacheEntry {
+  uint64_t basis_hash_ = 0;
+  uint64_t matrix_hash_ = 0;
+  HighsInt last_use_ = 0;
+  HighsInt update_count_ = 0;
+  double build_synthetic_tick_ = 0;
+  double total_synthetic_tick_ = 0;
+  std::vector<HighsInt> basic_index_;
+  InvertibleRepresentation invert_;
+  std::vector<double> dual_edge_weight_;
+};
+
 class HSimplexNla {
  private:
-  void setup(const HighsLp* lp, HighsInt* basic_index,
-             const HighsOptions* options, HighsTimer* timer,
-             HighsSimplexAnalysis* analysis,
-             const HighsSparseMatrix* factor_a_matrix,
-             const double factor_pivot_threshold);
+  HighsInt setup(const HighsLp* lp, HighsInt* basic_index,
+                 const HighsOptions* options, HighsTimer* timer,
+                 HighsSimplexAnalysis* analysis,
+                 const HighsSparseMatrix* factor_a_matrix,
+                 const double factor_pivot_threshold);
 
   void setLpAndScalePointers(const HighsLp* lp);
   void setBasicIndexPointers(HighsInt* basic_index);
@@ -85,6 +97,10 @@ class HSimplexNla {
   void ftranInScaledSpace(
       HVector& rhs, const double expected_density,
       HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void ftranInScaledSpace(
+      HVector* const* rhs, const HighsInt num_rhs,
+      const double* expected_density,
+      HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void frozenBtran(HVector& rhs) const;
   void frozenFtran(HVector& rhs) const;
   void update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint);
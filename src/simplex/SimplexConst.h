@@ -164,6 +164,11 @@ const double kAcceptDseWeightThreshold = 0.25;
 
 const double kMinDualSteepestEdgeWeight = 1e-4;
 
+// Minimum number of rows for which initial DSE weights are computed
+// in parallel, and the number of BTRANs per thread in each batch
+const HighsInt kParallelDseMinNumRow = 500;
+const HighsInt kParallelDseBatchSize = 128;
+
 const HighsInt kNoRowSought = -2;
 const HighsInt kNoRowChosen = -1;
 
@@ -15,8 +15,10 @@
 
 #include <cassert>
 #include <iostream>
+#include <limits>
 
 #include "lp_data/HConst.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "util/FactorTimer.h"
 #include "util/HFactorDebug.h"
@@ -34,9 +36,24 @@ using std::make_pair;
 using std::min;
 using std::pair;
 
+static HighsInt ftranUpperSpsClock(const double current_density) {
+  if (current_density < 0.1) return FactorFtranUpperSps2;
+  if (current_density < 0.5) return FactorFtranUpperSps1;
+  return FactorFtranUpperSps0;
+}
+
+static HighsInt ftranUpperHyperClock(const double current_density) {
+  if (current_density < 5e-6) return FactorFtranUpperHyper5;
+  if (current_density < 1e-5) return FactorFtranUpperHyper4;
+  if (current_density < 1e-4) return FactorFtranUpperHyper3;
+  if (current_density < 1e-3) return FactorFtranUpperHyper2;
+  if (current_density < 1e-2) return FactorFtranUpperHyper1;
+  return FactorFtranUpperHyper0;
+}
+
 static void solveMatrixT(const HighsInt X_Start, const HighsInt x_end,
                          const HighsInt y_start, const HighsInt y_end,
-                         const HighsInt* t_index, const double* t_value,
+                         const HFactorIndex* t_index, const double* t_value,
                          const double t_pivot, HighsInt* rhs_count,
                          HighsInt* rhs_index, double* rhs_array) {
   // Collect by X
@@ -64,7 +81,7 @@ static void solveMatrixT(const HighsInt X_Start, const HighsInt x_end,
 static void solveHyper(const HighsInt h_size, const HighsInt* h_lookup,
                        const HighsInt* h_pivot_index,
                        const double* h_pivot_value, const HighsInt* h_start,
-                       const HighsInt* h_end, const HighsInt* h_index,
+                       const HighsInt* h_end, const HFactorIndex* h_index,
                        const double* h_value, HVector* rhs) {
   HighsInt rhs_count = rhs->count;
   HighsInt* rhs_index = rhs->index.data();
@@ -160,53 +177,64 @@ static void solveHyper(const HighsInt h_size, const HighsInt* h_lookup,
   }
 }
 
-void HFactor::setup(const HighsSparseMatrix& a_matrix,
-                    std::vector<HighsInt>& basic_index,
-                    const double pivot_threshold, const double pivot_tolerance,
-                    const HighsInt highs_debug_level,
-                    const HighsLogOptions* log_options) {
+HighsInt HFactor::setup(const HighsSparseMatrix& a_matrix,
+                        std::vector<HighsInt>& basic_index,
+                        const double pivot_threshold,
+                        const double pivot_tolerance,
+                        const HighsInt highs_debug_level,
+                        const HighsLogOptions* log_options) {
   HighsInt basic_index_size = basic_index.size();
   // Nothing to do if basic index has no entries, and mustn't try to
   // pass the pointer to entry 0 of a vector of size 0.
-  if (basic_index_size <= 0) return;
-  this->setupGeneral(&a_matrix, basic_index_size, basic_index.data(),
-                     pivot_threshold, pivot_tolerance, highs_debug_level,
-                     log_options);
-  return;
+  if (basic_index_size <= 0) return 0;
+  return this->setupGeneral(&a_matrix, basic_index_size, basic_index.data(),
+                            pivot_threshold, pivot_tolerance,
+                            highs_debug_level, log_options);
 }
 
-void HFactor::setupGeneral(const HighsSparseMatrix* a_matrix,
-                           HighsInt num_basic, HighsInt* basic_index,
-                           const double pivot_threshold,
-                           const double pivot_tolerance,
-                           const HighsInt highs_debug_level,
-                           const HighsLogOptions* log_options) {
-  this->setupGeneral(a_matrix->num_col_, a_matrix->num_row_, num_basic,
-                     a_matrix->start_.data(), a_matrix->index_.data(),
-                     a_matrix->value_.data(), basic_index, pivot_threshold,
-                     pivot_tolerance, highs_debug_level, log_options, true,
-                     kUpdateMethodFt);
+HighsInt HFactor::setupGeneral(const HighsSparseMatrix* a_matrix,
+                               HighsInt num_basic, HighsInt* basic_index,
+                               const double pivot_threshold,
+                               const double pivot_tolerance,
+                               const HighsInt highs_debug_level,
+                               const HighsLogOptions* log_options) {
+  return this->setupGeneral(
+      a_matrix->num_col_, a_matrix->num_row_, num_basic,
+      a_matrix->start_.data(), a_matrix->index_.data(),
+      a_matrix->value_.data(), basic_index, pivot_threshold, pivot_tolerance,
+      highs_debug_level, log_options, true, kUpdateMethodFt);
 }
 
-void HFactor::setup(
+HighsInt HFactor::setup(
     const HighsInt num_col_, const HighsInt num_row_, const HighsInt* a_start_,
     const HighsInt* a_index_, const double* a_value_, HighsInt* basic_index_,
     const double pivot_threshold_, const double pivot_tolerance_,
     const HighsInt highs_debug_level_, const HighsLogOptions* log_options_,
     const bool use_original_HFactor_logic_, const HighsInt update_method_) {
-  setupGeneral(num_col_, num_row_, num_row_, a_start_, a_index_, a_value_,
-               basic_index_, pivot_threshold_, pivot_tolerance_,
-               highs_debug_level_, log_options_, use_original_HFactor_logic_,
-               update_method_);
+  return setupGeneral(num_col_, num_row_, num_row_, a_start_, a_index_,
+                      a_value_, basic_index_, pivot_threshold_,
+                      pivot_tolerance_, highs_debug_level_, log_options_,
+                      use_original_HFactor_logic_, update_method_);
 }
 
-void HFactor::setupGeneral(
+HighsInt HFactor::setupGeneral(
     const HighsInt num_col_, const HighsInt num_row_, HighsInt num_basic_,
     const HighsInt* a_start_, const HighsInt* a_index_, const double* a_value_,
     HighsInt* basic_index_, const double pivot_threshold_,
     const double pivot_tolerance_, const HighsInt highs_debug_level_,
     const HighsLogOptions* log_options_, const bool use_original_HFactor_logic_,
     const HighsInt update_method_) {
+  // Indices in the factors are of type HFactorIndex, so the
+  // dimensions of the basis matrix must fit into it
+  const HighsInt max_dim = max(num_row_, num_basic_);
+  if (max_dim > std::numeric_limits<HFactorIndex>::max()) {
+    if (log_options_)
+      highsLogUser(*log_options_, HighsLogType::kError,
+                   "HFactor::setup: basis matrix dimension %" HIGHSINT_FORMAT
+                   " exceeds the limit of %d for factor indices\n",
+                   max_dim, (int)std::numeric_limits<HFactorIndex>::max());
+    return kSetupReturnIndexOverflow;
+  }
   // Copy Problem size and (pointer to) coefficient matrix
   num_row = num_row_;
   num_col = num_col_;
@@ -340,6 +368,7 @@ void HFactor::setupGeneral(
   // std::vector<double>.
   rhs_.setup(num_row);
   rhs_.count = -1;
+  return 0;
 }
 
 void HFactor::setupMatrix(const HighsInt* a_start_, const HighsInt* a_index_,
@@ -490,6 +519,34 @@ void HFactor::ftranCall(std::vector<double>& vector,
   factor_timer.stop(FactorFtran, factor_timer_clock_pointer);
 }
 
+void HFactor::ftranMulti(HVector* const* vector, const HighsInt num_vector,
+                         const double* expected_density,
+                         HighsTimerClock* factor_timer_clock_pointer) const {
+  assert(num_vector <= kFtranMultiMaxNumVector);
+  // Only the Forrest-Tomlin update is applied to several vectors at
+  // once, so use the single vector FTRAN for a single RHS or any
+  // other update method
+  if (num_vector == 1 || update_method != kUpdateMethodFt) {
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+      ftranCall(*vector[iVec], expected_density[iVec],
+                factor_timer_clock_pointer);
+    return;
+  }
+  bool use_indices[kFtranMultiMaxNumVector];
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    use_indices[iVec] = vector[iVec]->count >= 0;
+  FactorTimer factor_timer;
+  factor_timer.start(FactorFtran, factor_timer_clock_pointer);
+  ftranLMulti(vector, num_vector, expected_density,
+              factor_timer_clock_pointer);
+  ftranUMulti(vector, num_vector, expected_density,
+              factor_timer_clock_pointer);
+  // Possibly find the indices in order
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++)
+    if (use_indices[iVec]) vector[iVec]->reIndex();
+  factor_timer.stop(FactorFtran, factor_timer_clock_pointer);
+}
+
 void HFactor::btranCall(HVector& vector, const double expected_density,
                         HighsTimerClock* factor_timer_clock_pointer) const {
   const bool use_indices = vector.count >= 0;
@@ -515,6 +572,12 @@ void HFactor::btranCall(std::vector<double>& vector,
   vector = std::move(this->rhs_.array);
 }
 
+HighsInt HFactor::btranStyle(const double expected_density) const {
+  // As determined in btranU and btranL
+  return (expected_density > kHyperBtranU ? 2 : 0) +
+         (expected_density > kHyperBtranL ? 1 : 0);
+}
+
 void HFactor::update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint) {
   // Updating implies a change of basis. Since the refactorizaion info
   // no longer corresponds to the current basis, it must be
@@ -557,6 +620,8 @@ void HFactor::luClear() {
   u_start.push_back(0);
   u_index.clear();
   u_value.clear();
+
+  clearTranLevels();
 }
 
 void HFactor::buildSimple() {
@@ -1138,103 +1203,108 @@ HighsInt HFactor::buildKernel() {
     // 2.4. Loop over pivot row to eliminate other column
     const HighsInt row_start = mr_start[iRowPivot];
     const HighsInt row_end = row_start + mr_count[iRowPivot];
-    for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
-      // 2.4.1. My pointer
-      HighsInt iCol = mr_index[row_k];
-      const HighsInt my_count = mc_count_a[iCol];
-      const HighsInt my_start = mc_start[iCol];
-      const HighsInt my_end = my_start + my_count - 1;
-      double my_pivot = colDelete(iCol, iRowPivot);
-      colStoreN(iCol, iRowPivot, my_pivot);
-
-      // 2.4.2. Elimination on the overlapping part
-      HighsInt nFillin = mwz_column_count;
-      HighsInt nCancel = 0;
-      for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-        HighsInt iRow = mc_index[my_k];
-        double value = mc_value[my_k];
-        if (mwz_column_mark[iRow]) {
-          mwz_column_mark[iRow] = 0;
-          nFillin--;
-          value -= my_pivot * mwz_column_array[iRow];
-          if (fabs(value) < kHighsTiny) {
-            value = 0;
-            nCancel++;
+    if (kernelParallelEliminate(row_end - row_start, mwz_column_count)) {
+      fake_eliminate +=
+          buildKernelParallelEliminate(iRowPivot, mwz_column_count);
+    } else {
+      for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
+        // 2.4.1. My pointer
+        HighsInt iCol = mr_index[row_k];
+        const HighsInt my_count = mc_count_a[iCol];
+        const HighsInt my_start = mc_start[iCol];
+        const HighsInt my_end = my_start + my_count - 1;
+        double my_pivot = colDelete(iCol, iRowPivot);
+        colStoreN(iCol, iRowPivot, my_pivot);
+
+        // 2.4.2. Elimination on the overlapping part
+        HighsInt nFillin = mwz_column_count;
+        HighsInt nCancel = 0;
+        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+          HighsInt iRow = mc_index[my_k];
+          double value = mc_value[my_k];
+          if (mwz_column_mark[iRow]) {
+            mwz_column_mark[iRow] = 0;
+            nFillin--;
+            value -= my_pivot * mwz_column_array[iRow];
+            if (fabs(value) < kHighsTiny) {
+              value = 0;
+              nCancel++;
+            }
+            mc_value[my_k] = value;
           }
-          mc_value[my_k] = value;
         }
-      }
-      fake_eliminate += mwz_column_count;
-      fake_eliminate += nFillin * 2;
-
-      // 2.4.3. Remove cancellation gaps
-      if (nCancel > 0) {
-        HighsInt new_end = my_start;
-        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-          if (mc_value[my_k] != 0) {
-            mc_index[new_end] = mc_index[my_k];
-            mc_value[new_end++] = mc_value[my_k];
-          } else {
-            rowDelete(iCol, mc_index[my_k]);
+        fake_eliminate += mwz_column_count;
+        fake_eliminate += nFillin * 2;
+
+        // 2.4.3. Remove cancellation gaps
+        if (nCancel > 0) {
+          HighsInt new_end = my_start;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            if (mc_value[my_k] != 0) {
+              mc_index[new_end] = mc_index[my_k];
+              mc_value[new_end++] = mc_value[my_k];
+            } else {
+              rowDelete(iCol, mc_index[my_k]);
+            }
           }
+          mc_count_a[iCol] = new_end - my_start;
         }
-        mc_count_a[iCol] = new_end - my_start;
-      }
 
-      // 2.4.4. Insert fill-in
-      if (nFillin > 0) {
-        // 2.4.4.1 Check column size
-        if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
-          // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
-          HighsInt p1 = mc_start[iCol];
-          HighsInt p2 = p1 + mc_count_a[iCol];
-          HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
-          HighsInt p4 = p1 + mc_space[iCol];
-          mc_space[iCol] += max(mc_space[iCol], nFillin);
-          HighsInt p5 = mc_start[iCol] = mc_index.size();
-          HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
-          mc_index.resize(p5 + mc_space[iCol]);
-          mc_value.resize(p5 + mc_space[iCol]);
-          copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
-          copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
-          copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
-          copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
-        }
+        // 2.4.4. Insert fill-in
+        if (nFillin > 0) {
+          // 2.4.4.1 Check column size
+          if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
+            // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
+            HighsInt p1 = mc_start[iCol];
+            HighsInt p2 = p1 + mc_count_a[iCol];
+            HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
+            HighsInt p4 = p1 + mc_space[iCol];
+            mc_space[iCol] += max(mc_space[iCol], nFillin);
+            HighsInt p5 = mc_start[iCol] = mc_index.size();
+            HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
+            mc_index.resize(p5 + mc_space[iCol]);
+            mc_value.resize(p5 + mc_space[iCol]);
+            copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
+            copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
+            copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
+            copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
+          }
 
-        // 2.4.4.2 Fill into column copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow])
-            colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
-        }
+          // 2.4.4.2 Fill into column copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow])
+              colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
+          }
 
-        // 2.4.4.3 Fill into the row copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow]) {
-            // Expand row space
-            if (mr_count[iRow] == mr_space[iRow]) {
-              HighsInt p1 = mr_start[iRow];
-              HighsInt p2 = p1 + mr_count[iRow];
-              HighsInt p3 = mr_start[iRow] = mr_index.size();
-              mr_space[iRow] *= 2;
-              mr_index.resize(p3 + mr_space[iRow]);
-              copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+          // 2.4.4.3 Fill into the row copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow]) {
+              // Expand row space
+              if (mr_count[iRow] == mr_space[iRow]) {
+                HighsInt p1 = mr_start[iRow];
+                HighsInt p2 = p1 + mr_count[iRow];
+                HighsInt p3 = mr_start[iRow] = mr_index.size();
+                mr_space[iRow] *= 2;
+                mr_index.resize(p3 + mr_space[iRow]);
+                copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+              }
+              rowInsert(iCol, iRow);
             }
-            rowInsert(iCol, iRow);
           }
         }
-      }
 
-      // 2.4.5. Reset pivot column mark
-      for (HighsInt i = 0; i < mwz_column_count; i++)
-        mwz_column_mark[mwz_column_index[i]] = 1;
+        // 2.4.5. Reset pivot column mark
+        for (HighsInt i = 0; i < mwz_column_count; i++)
+          mwz_column_mark[mwz_column_index[i]] = 1;
 
-      // 2.4.6. Fix max value and link list
-      colFixMax(iCol);
-      if (my_count != mc_count_a[iCol]) {
-        clinkDel(iCol);
-        clinkAdd(iCol, mc_count_a[iCol]);
+        // 2.4.6. Fix max value and link list
+        colFixMax(iCol);
+        if (my_count != mc_count_a[iCol]) {
+          clinkDel(iCol);
+          clinkAdd(iCol, mc_count_a[iCol]);
+        }
       }
     }
 
@@ -1257,6 +1327,177 @@ HighsInt HFactor::buildKernel() {
   return rank_deficiency;
 }
 
+bool HFactor::kernelParallelEliminate(const HighsInt pivot_row_count,
+                                      const HighsInt mwz_column_count) const {
+  if (pivot_row_count < kKernelParallelMinCount ||
+      1.0 * pivot_row_count * mwz_column_count < kKernelParallelMinWork)
+    return false;
+  HighsSplitDeque* worker_deque = HighsTaskExecutor::getThisWorkerDeque();
+  return worker_deque != nullptr && worker_deque->getNumWorkers() > 1;
+}
+
+double HFactor::buildKernelParallelEliminate(const HighsInt iRowPivot,
+                                             const HighsInt mwz_column_count) {
+  // Apart from changes to the row-wise copy of the kernel, and the
+  // allocation of space for fill-in, the updates of the columns in
+  // the pivotal row are independent. Hence the numerical updates are
+  // performed in parallel, recording the cancelled and fill-in rows
+  // for each column. The structural changes are then made in the
+  // order of the serial elimination, so the factors are identical.
+  const HighsInt num_worker = highs::parallel::num_threads();
+  if ((HighsInt)worker_row_mark.size() < num_worker) {
+    worker_row_mark.resize(num_worker);
+    worker_row_buffer.resize(num_worker);
+  }
+  for (HighsInt worker = 0; worker < num_worker; worker++) {
+    // Row marks are cleared after use, so only need to be set up
+    if ((HighsInt)worker_row_mark[worker].size() != num_row)
+      worker_row_mark[worker].assign(num_row, 0);
+    worker_row_buffer[worker].clear();
+  }
+  const HighsInt row_start = mr_start[iRowPivot];
+  const HighsInt row_count = mr_count[iRowPivot];
+  kernel_column_update.resize(row_count);
+
+  highs::parallel::for_each(
+      0, row_count,
+      [&](HighsInt from_k, HighsInt to_k) {
+        const HighsInt worker = highs::parallel::thread_num();
+        vector<char>& row_mark = worker_row_mark[worker];
+        vector<HighsInt>& row_buffer = worker_row_buffer[worker];
+        for (HighsInt row_k = from_k; row_k < to_k; row_k++) {
+          const HighsInt iCol = mr_index[row_start + row_k];
+          KernelColumnUpdate& update = kernel_column_update[row_k];
+          update.count = mc_count_a[iCol];
+          update.worker = worker;
+          update.start = row_buffer.size();
+          const HighsInt my_start = mc_start[iCol];
+          const HighsInt my_end = my_start + update.count - 1;
+          const double my_pivot = colDelete(iCol, iRowPivot);
+          colStoreN(iCol, iRowPivot, my_pivot);
+          update.pivot = my_pivot;
+
+          // Elimination on the overlapping part
+          HighsInt nCancel = 0;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            HighsInt iRow = mc_index[my_k];
+            double value = mc_value[my_k];
+            if (mwz_column_mark[iRow]) {
+              row_mark[iRow] = 1;
+              value -= my_pivot * mwz_column_array[iRow];
+              if (fabs(value) < kHighsTiny) {
+                value = 0;
+                nCancel++;
+              }
+              mc_value[my_k] = value;
+            }
+          }
+
+          // Remove cancellation gaps, recording the rows
+          if (nCancel > 0) {
+            HighsInt new_end = my_start;
+            for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+              if (mc_value[my_k] != 0) {
+                mc_index[new_end] = mc_index[my_k];
+                mc_value[new_end++] = mc_value[my_k];
+              } else {
+                row_buffer.push_back(mc_index[my_k]);
+              }
+            }
+            mc_count_a[iCol] = new_end - my_start;
+          }
+          update.num_cancel = row_buffer.size() - update.start;
+
+          // Record the fill-in rows, clearing the row marks
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (row_mark[iRow])
+              row_mark[iRow] = 0;
+            else
+              row_buffer.push_back(iRow);
+          }
+          update.num_fill =
+              row_buffer.size() - update.start - update.num_cancel;
+
+          // Find the maximum value in the column once filled in
+          double max_value = 0;
+          for (HighsInt k = my_start; k < my_start + mc_count_a[iCol]; k++)
+            max_value = max(max_value, fabs(mc_value[k]));
+          const HighsInt* fill_row =
+              &row_buffer[update.start + update.num_cancel];
+          for (HighsInt i = 0; i < update.num_fill; i++)
+            max_value = max(max_value,
+                            fabs(-my_pivot * mwz_column_array[fill_row[i]]));
+          update.max_value = max_value;
+        }
+      },
+      8);
+
+  double fake_eliminate = 0;
+  for (HighsInt row_k = 0; row_k < row_count; row_k++) {
+    const HighsInt iCol = mr_index[row_start + row_k];
+    const KernelColumnUpdate& update = kernel_column_update[row_k];
+    const HighsInt* cancel_row =
+        worker_row_buffer[update.worker].data() + update.start;
+    const HighsInt* fill_row = cancel_row + update.num_cancel;
+    for (HighsInt i = 0; i < update.num_cancel; i++)
+      rowDelete(iCol, cancel_row[i]);
+    const HighsInt nFillin = update.num_fill;
+    fake_eliminate += mwz_column_count;
+    fake_eliminate += nFillin * 2;
+
+    // Insert fill-in
+    if (nFillin > 0) {
+      // Check column size
+      if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
+        // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
+        HighsInt p1 = mc_start[iCol];
+        HighsInt p2 = p1 + mc_count_a[iCol];
+        HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
+        HighsInt p4 = p1 + mc_space[iCol];
+        mc_space[iCol] += max(mc_space[iCol], nFillin);
+        HighsInt p5 = mc_start[iCol] = mc_index.size();
+        HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
+        mc_index.resize(p5 + mc_space[iCol]);
+        mc_value.resize(p5 + mc_space[iCol]);
+        copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
+        copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
+        copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
+        copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
+      }
+
+      // Fill into column copy
+      for (HighsInt i = 0; i < nFillin; i++) {
+        HighsInt iRow = fill_row[i];
+        colInsert(iCol, iRow, -update.pivot * mwz_column_array[iRow]);
+      }
+
+      // Fill into the row copy
+      for (HighsInt i = 0; i < nFillin; i++) {
+        HighsInt iRow = fill_row[i];
+        // Expand row space
+        if (mr_count[iRow] == mr_space[iRow]) {
+          HighsInt p1 = mr_start[iRow];
+          HighsInt p2 = p1 + mr_count[iRow];
+          HighsInt p3 = mr_start[iRow] = mr_index.size();
+          mr_space[iRow] *= 2;
+          mr_index.resize(p3 + mr_space[iRow]);
+          copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+        }
+        rowInsert(iCol, iRow);
+      }
+    }
+
+    // Fix max value and link list
+    mc_min_pivot[iCol] = update.max_value * pivot_threshold;
+    if (update.count != mc_count_a[iCol]) {
+      clinkDel(iCol);
+      clinkAdd(iCol, mc_count_a[iCol]);
+    }
+  }
+  return fake_eliminate;
+}
+
 void HFactor::buildHandleRankDeficiency() {
   debugReportRankDeficiency(0, highs_debug_level, log_options, num_row, permute,
                             iwork, basic_index, rank_deficiency,
@@ -1496,6 +1737,72 @@ void HFactor::buildFinish() {
     // Add cost of buildFinish to build_synthetic_tick
     build_synthetic_tick += num_row * 80 + (LcountX + u_countX) * 60;
   }
+  buildTranLevels();
+}
+
+void HFactor::buildTranLevels() {
+  clearTranLevels();
+  if (!parallel_tran_ || num_row < kParallelTranMinDim) return;
+  // FTRAN with L gathers over the rows of L, and BTRAN with L over
+  // its columns
+  buildTranLevel(ftran_l_level, true, l_pivot_index.data(),
+                 l_pivot_lookup.data(), lr_start.data(), &lr_start[1],
+                 lr_index.data());
+  buildTranLevel(btran_l_level, false, l_pivot_index.data(),
+                 l_pivot_lookup.data(), l_start.data(), &l_start[1],
+                 l_index.data());
+  // FTRAN with U gathers over the rows of U, and BTRAN with U over
+  // its columns
+  buildTranLevel(ftran_u_level, false, u_pivot_index.data(),
+                 u_pivot_lookup.data(), ur_start.data(), ur_lastp.data(),
+                 ur_index.data());
+  buildTranLevel(btran_u_level, true, u_pivot_index.data(),
+                 u_pivot_lookup.data(), u_start.data(), u_last_p.data(),
+                 u_index.data());
+}
+
+void HFactor::buildTranLevel(HFactorTranLevel& level, const bool forward,
+                             const HighsInt* pivot_index,
+                             const HighsInt* lookup,
+                             const HighsInt* dep_start,
+                             const HighsInt* dep_end,
+                             const HFactorIndex* dep_index) {
+  // The level of a pivot is one more than the highest level of the
+  // pivots on which it depends, all of which precede it in the
+  // serial order of the TRAN
+  vector<HighsInt> pivot_level(num_row, 0);
+  HighsInt num_level = 0;
+  for (HighsInt iK = 0; iK < num_row; iK++) {
+    const HighsInt i = forward ? iK : num_row - 1 - iK;
+    if (pivot_index[i] < 0) continue;
+    HighsInt i_level = 0;
+    for (HighsInt k = dep_start[i]; k < dep_end[i]; k++) {
+      const HighsInt j = lookup[dep_index[k]];
+      assert(forward ? j < i : j > i);
+      i_level = max(pivot_level[j] + 1, i_level);
+    }
+    pivot_level[i] = i_level;
+    num_level = max(i_level + 1, num_level);
+  }
+  // Only worth solving over levels if they are wide enough
+  if (num_row < num_level * kParallelTranMinLevelWidth) return;
+  level.start.assign(num_level + 1, 0);
+  for (HighsInt i = 0; i < num_row; i++)
+    if (pivot_index[i] >= 0) level.start[pivot_level[i] + 1]++;
+  for (HighsInt iLevel = 0; iLevel < num_level; iLevel++)
+    level.start[iLevel + 1] += level.start[iLevel];
+  vector<HighsInt> level_put(level.start.begin(), level.start.end() - 1);
+  level.pivot.resize(level.start[num_level]);
+  for (HighsInt i = 0; i < num_row; i++)
+    if (pivot_index[i] >= 0) level.pivot[level_put[pivot_level[i]]++] = i;
+  level.parallel = true;
+}
+
+void HFactor::clearTranLevels() {
+  ftran_l_level.clear();
+  btran_l_level.clear();
+  ftran_u_level.clear();
+  btran_u_level.clear();
 }
 
 void HFactor::zeroCol(const HighsInt jCol) {
@@ -1524,6 +1831,48 @@ void HFactor::zeroCol(const HighsInt jCol) {
   mc_count_n[jCol] = 0;
 }
 
+bool HFactor::useParallelTran(const HFactorTranLevel& level,
+                              const double expected_density) const {
+  if (!level.parallel || expected_density < kParallelTranMinDensity)
+    return false;
+  HighsSplitDeque* worker_deque = HighsTaskExecutor::getThisWorkerDeque();
+  return worker_deque != nullptr && worker_deque->getNumWorkers() > 1;
+}
+
+void HFactor::solveTranLevel(const HFactorTranLevel& level,
+                             const HighsInt* pivot_index,
+                             const double* pivot_value,
+                             const HighsInt* dep_start,
+                             const HighsInt* dep_end,
+                             const HFactorIndex* dep_index,
+                             const double* dep_value,
+                             double* rhs_array) const {
+  // Each pivot gathers the values of the pivots on which it depends,
+  // so the pivots in a level can be solved in parallel. Pivots
+  // removed by updates are skipped
+  const HighsInt num_level = level.start.size() - 1;
+  for (HighsInt iLevel = 0; iLevel < num_level; iLevel++) {
+    highs::parallel::for_each(
+        level.start[iLevel], level.start[iLevel + 1],
+        [&](HighsInt from_iP, HighsInt to_iP) {
+          for (HighsInt iP = from_iP; iP < to_iP; iP++) {
+            const HighsInt i = level.pivot[iP];
+            const HighsInt pivotRow = pivot_index[i];
+            if (pivotRow < 0) continue;
+            double value = rhs_array[pivotRow];
+            for (HighsInt k = dep_start[i]; k < dep_end[i]; k++)
+              value -= dep_value[k] * rhs_array[dep_index[k]];
+            if (fabs(value) <= kHighsTiny)
+              value = 0;
+            else if (pivot_value)
+              value /= pivot_value[i];
+            rhs_array[pivotRow] = value;
+          }
+        },
+        kParallelTranMinLevelWidth);
+  }
+}
+
 void HFactor::ftranL(HVector& rhs, const double expected_density,
                      HighsTimerClock* factor_timer_clock_pointer) const {
   FactorTimer factor_timer;
@@ -1542,14 +1891,28 @@ void HFactor::ftranL(HVector& rhs, const double expected_density,
   double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperFtranL;
-  if (sparse_solve) {
+  if (sparse_solve && useParallelTran(ftran_l_level, expected_density)) {
+    factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
+    HighsInt* rhs_index = rhs.index.data();
+    double* rhs_array = rhs.array.data();
+    solveTranLevel(ftran_l_level, l_pivot_index.data(), nullptr,
+                   lr_start.data(), &lr_start[1], lr_index.data(),
+                   lr_value.data(), rhs_array);
+    HighsInt rhs_count = 0;
+    for (HighsInt i = 0; i < num_row; i++) {
+      const HighsInt pivotRow = l_pivot_index[i];
+      if (rhs_array[pivotRow]) rhs_index[rhs_count++] = pivotRow;
+    }
+    rhs.count = rhs_count;
+    factor_timer.stop(FactorFtranLowerSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt* rhs_index = rhs.index.data();
     double* rhs_array = rhs.array.data();
     // Alias to factor L
     const HighsInt* l_start = this->l_start.data();
-    const HighsInt* l_index = this->l_index.data();
+    const HFactorIndex* l_index = this->l_index.data();
     const double* l_value = this->l_value.data();
     // Local accumulation of RHS count
     HighsInt rhs_count = 0;
@@ -1572,7 +1935,7 @@ void HFactor::ftranL(HVector& rhs, const double expected_density,
   } else {
     // Hyper-sparse solve
     factor_timer.start(FactorFtranLowerHyper, factor_timer_clock_pointer);
-    const HighsInt* l_index = this->l_index.data();
+    const HFactorIndex* l_index = this->l_index.data();
     const double* l_value = this->l_value.data();
     solveHyper(num_row, l_pivot_lookup.data(), l_pivot_index.data(), 0,
                l_start.data(), &l_start[1], &l_index[0], &l_value[0], &rhs);
@@ -1590,14 +1953,28 @@ void HFactor::btranL(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperBtranL;
-  if (sparse_solve) {
+  if (sparse_solve && useParallelTran(btran_l_level, expected_density)) {
+    factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
+    HighsInt* rhs_index = rhs.index.data();
+    double* rhs_array = rhs.array.data();
+    solveTranLevel(btran_l_level, l_pivot_index.data(), nullptr,
+                   l_start.data(), &l_start[1], l_index.data(),
+                   l_value.data(), rhs_array);
+    HighsInt rhs_count = 0;
+    for (HighsInt i = num_row - 1; i >= 0; i--) {
+      const HighsInt pivotRow = l_pivot_index[i];
+      if (rhs_array[pivotRow]) rhs_index[rhs_count++] = pivotRow;
+    }
+    rhs.count = rhs_count;
+    factor_timer.stop(FactorBtranLowerSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt* rhs_index = rhs.index.data();
     double* rhs_array = rhs.array.data();
     // Alias to factor L
     const HighsInt* lr_start = this->lr_start.data();
-    const HighsInt* lr_index = this->lr_index.data();
+    const HFactorIndex* lr_index = this->lr_index.data();
     const double* lr_value = this->lr_value.data();
     // Local accumulation of RHS count
     HighsInt rhs_count = 0;
@@ -1621,7 +1998,7 @@ void HFactor::btranL(HVector& rhs, const double expected_density,
   } else {
     // Hyper-sparse solve
     factor_timer.start(FactorBtranLowerHyper, factor_timer_clock_pointer);
-    const HighsInt* lr_index = this->lr_index.data();
+    const HFactorIndex* lr_index = this->lr_index.data();
     const double* lr_value = this->lr_value.data();
     solveHyper(num_row, l_pivot_lookup.data(), l_pivot_index.data(), 0,
                lr_start.data(), &lr_start[1], &lr_index[0], &lr_value[0], &rhs);
@@ -1665,16 +2042,46 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperFtranU;
-  if (sparse_solve) {
+  if (sparse_solve && useParallelTran(ftran_u_level, expected_density)) {
+    const HighsInt use_clock = ftranUpperSpsClock(current_density);
+    factor_timer.start(use_clock, factor_timer_clock_pointer);
+    HighsInt* rhs_index = rhs.index.data();
+    double* rhs_array = rhs.array.data();
+    // The pivots from updates precede those from INVERT in the serial
+    // order, so are solved first
+    double rhs_synthetic_tick = 0;
+    const HighsInt u_pivot_count = u_pivot_index.size();
+    for (HighsInt i_logic = u_pivot_count - 1; i_logic >= num_row;
+         i_logic--) {
+      const HighsInt pivotRow = u_pivot_index[i_logic];
+      if (pivotRow == -1) continue;
+      double value = rhs_array[pivotRow];
+      for (HighsInt k = ur_start[i_logic]; k < ur_lastp[i_logic]; k++)
+        value -= ur_value[k] * rhs_array[ur_index[k]];
+      if (fabs(value) > kHighsTiny) {
+        rhs_array[pivotRow] = value / u_pivot_value[i_logic];
+        rhs_synthetic_tick += u_last_p[i_logic] - u_start[i_logic];
+      } else {
+        rhs_array[pivotRow] = 0;
+      }
+    }
+    solveTranLevel(ftran_u_level, u_pivot_index.data(), u_pivot_value.data(),
+                   ur_start.data(), ur_lastp.data(), ur_index.data(),
+                   ur_value.data(), rhs_array);
+    HighsInt rhs_count = 0;
+    for (HighsInt i_logic = u_pivot_count - 1; i_logic >= 0; i_logic--) {
+      const HighsInt pivotRow = u_pivot_index[i_logic];
+      if (pivotRow >= 0 && rhs_array[pivotRow])
+        rhs_index[rhs_count++] = pivotRow;
+    }
+    rhs.count = rhs_count;
+    rhs.synthetic_tick +=
+        rhs_synthetic_tick * 15 + (u_pivot_count - num_row) * 10;
+    factor_timer.stop(use_clock, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     const bool report_ftran_upper_sparse =
         false;  // current_density < kHyperCancel;
-    HighsInt use_clock;
-    if (current_density < 0.1)
-      use_clock = FactorFtranUpperSps2;
-    else if (current_density < 0.5)
-      use_clock = FactorFtranUpperSps1;
-    else
-      use_clock = FactorFtranUpperSps0;
+    const HighsInt use_clock = ftranUpperSpsClock(current_density);
     factor_timer.start(use_clock, factor_timer_clock_pointer);
     // Alias to non constant
     double rhs_synthetic_tick = 0;
@@ -1684,7 +2091,7 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
     // Alias to factor U
     const HighsInt* u_start = this->u_start.data();
     const HighsInt* u_end = this->u_last_p.data();
-    const HighsInt* u_index = this->u_index.data();
+    const HFactorIndex* u_index = this->u_index.data();
     const double* u_value = this->u_value.data();
     // Local accumulation of RHS count
     HighsInt rhs_count = 0;
@@ -1723,21 +2130,9 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
           expected_density, current_density, final_density);
     }
   } else {
-    HighsInt use_clock = -1;
-    if (current_density < 5e-6)
-      use_clock = FactorFtranUpperHyper5;
-    else if (current_density < 1e-5)
-      use_clock = FactorFtranUpperHyper4;
-    else if (current_density < 1e-4)
-      use_clock = FactorFtranUpperHyper3;
-    else if (current_density < 1e-3)
-      use_clock = FactorFtranUpperHyper2;
-    else if (current_density < 1e-2)
-      use_clock = FactorFtranUpperHyper1;
-    else
-      use_clock = FactorFtranUpperHyper0;
+    const HighsInt use_clock = ftranUpperHyperClock(current_density);
     factor_timer.start(use_clock, factor_timer_clock_pointer);
-    const HighsInt* u_index = this->u_index.data();
+    const HFactorIndex* u_index = this->u_index.data();
     const double* u_value = this->u_value.data();
     solveHyper(num_row, u_pivot_lookup.data(), u_pivot_index.data(),
                u_pivot_value.data(), u_start.data(), u_last_p.data(),
@@ -1755,6 +2150,169 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
   factor_timer.stop(FactorFtranUpper, factor_timer_clock_pointer);
 }
 
+void HFactor::ftranLMulti(HVector* const* vector, const HighsInt num_vector,
+                          const double* expected_density,
+                          HighsTimerClock* factor_timer_clock_pointer) const {
+  assert(update_method != kUpdateMethodApf);
+  FactorTimer factor_timer;
+  factor_timer.start(FactorFtranLower, factor_timer_clock_pointer);
+  // Vectors for which ftranL would perform a hyper-sparse solve are
+  // solved individually. The others are solved in one pass over L
+  HighsInt num_sparse = 0;
+  HVector* sparse_vector[kFtranMultiMaxNumVector];
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vector[iVec];
+    const double current_density = 1.0 * rhs.count / num_row;
+    const bool sparse_solve = rhs.count < 0 ||
+                              current_density > kHyperCancel ||
+                              expected_density[iVec] > kHyperFtranL;
+    if (sparse_solve) {
+      sparse_vector[num_sparse++] = &rhs;
+    } else {
+      factor_timer.start(FactorFtranLowerHyper, factor_timer_clock_pointer);
+      const HFactorIndex* l_index = this->l_index.data();
+      const double* l_value = this->l_value.data();
+      solveHyper(num_row, l_pivot_lookup.data(), l_pivot_index.data(), 0,
+                 l_start.data(), &l_start[1], &l_index[0], &l_value[0], &rhs);
+      factor_timer.stop(FactorFtranLowerHyper, factor_timer_clock_pointer);
+    }
+  }
+  if (num_sparse) {
+    factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
+    // Alias to RHS
+    HighsInt* rhs_index[kFtranMultiMaxNumVector];
+    double* rhs_array[kFtranMultiMaxNumVector];
+    // Local accumulation of RHS count
+    HighsInt rhs_count[kFtranMultiMaxNumVector];
+    for (HighsInt iVec = 0; iVec < num_sparse; iVec++) {
+      rhs_index[iVec] = sparse_vector[iVec]->index.data();
+      rhs_array[iVec] = sparse_vector[iVec]->array.data();
+      rhs_count[iVec] = 0;
+    }
+    // Alias to factor L
+    const HighsInt* l_start = this->l_start.data();
+    const HFactorIndex* l_index = this->l_index.data();
+    const double* l_value = this->l_value.data();
+    // Transform
+    for (HighsInt i = 0; i < num_row; i++) {
+      HighsInt pivotRow = l_pivot_index[i];
+      const HighsInt start = l_start[i];
+      const HighsInt end = l_start[i + 1];
+      for (HighsInt iVec = 0; iVec < num_sparse; iVec++) {
+        double* array = rhs_array[iVec];
+        const double pivot_multiplier = array[pivotRow];
+        if (fabs(pivot_multiplier) > kHighsTiny) {
+          rhs_index[iVec][rhs_count[iVec]++] = pivotRow;
+          for (HighsInt k = start; k < end; k++)
+            array[l_index[k]] -= pivot_multiplier * l_value[k];
+        } else
+          array[pivotRow] = 0;
+      }
+    }
+    // Save the counts
+    for (HighsInt iVec = 0; iVec < num_sparse; iVec++)
+      sparse_vector[iVec]->count = rhs_count[iVec];
+    factor_timer.stop(FactorFtranLowerSps, factor_timer_clock_pointer);
+  }
+  factor_timer.stop(FactorFtranLower, factor_timer_clock_pointer);
+}
+
+void HFactor::ftranUMulti(HVector* const* vector, const HighsInt num_vector,
+                          const double* expected_density,
+                          HighsTimerClock* factor_timer_clock_pointer) const {
+  assert(update_method == kUpdateMethodFt);
+  FactorTimer factor_timer;
+  factor_timer.start(FactorFtranUpper, factor_timer_clock_pointer);
+  // The update part
+  factor_timer.start(FactorFtranUpperFT, factor_timer_clock_pointer);
+  ftranFTMulti(vector, num_vector);
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    vector[iVec]->tight();
+    vector[iVec]->pack();
+  }
+  factor_timer.stop(FactorFtranUpperFT, factor_timer_clock_pointer);
+
+  // The regular part
+  //
+  // Vectors for which ftranU would perform a hyper-sparse solve are
+  // solved individually. The others are solved in one pass over U
+  HighsInt num_sparse = 0;
+  HVector* sparse_vector[kFtranMultiMaxNumVector];
+  double max_sparse_density = 0;
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vector[iVec];
+    assert(rhs.count >= 0);
+    const double current_density = 1.0 * rhs.count / num_row;
+    const bool sparse_solve = current_density > kHyperCancel ||
+                              expected_density[iVec] > kHyperFtranU;
+    if (sparse_solve) {
+      sparse_vector[num_sparse++] = &rhs;
+      max_sparse_density = max(current_density, max_sparse_density);
+    } else {
+      const HighsInt use_clock = ftranUpperHyperClock(current_density);
+      factor_timer.start(use_clock, factor_timer_clock_pointer);
+      const HFactorIndex* u_index = this->u_index.data();
+      const double* u_value = this->u_value.data();
+      solveHyper(num_row, u_pivot_lookup.data(), u_pivot_index.data(),
+                 u_pivot_value.data(), u_start.data(), u_last_p.data(),
+                 &u_index[0], &u_value[0], &rhs);
+      factor_timer.stop(use_clock, factor_timer_clock_pointer);
+    }
+  }
+  if (num_sparse) {
+    const HighsInt use_clock = ftranUpperSpsClock(max_sparse_density);
+    factor_timer.start(use_clock, factor_timer_clock_pointer);
+    // Alias to RHS
+    HighsInt* rhs_index[kFtranMultiMaxNumVector];
+    double* rhs_array[kFtranMultiMaxNumVector];
+    // Local accumulation of RHS count and synthetic tick
+    HighsInt rhs_count[kFtranMultiMaxNumVector];
+    double rhs_synthetic_tick[kFtranMultiMaxNumVector];
+    for (HighsInt iVec = 0; iVec < num_sparse; iVec++) {
+      rhs_index[iVec] = sparse_vector[iVec]->index.data();
+      rhs_array[iVec] = sparse_vector[iVec]->array.data();
+      rhs_count[iVec] = 0;
+      rhs_synthetic_tick[iVec] = 0;
+    }
+    // Alias to factor U
+    const HighsInt* u_start = this->u_start.data();
+    const HighsInt* u_end = this->u_last_p.data();
+    const HFactorIndex* u_index = this->u_index.data();
+    const double* u_value = this->u_value.data();
+    // Transform
+    HighsInt u_pivot_count = u_pivot_index.size();
+    for (HighsInt i_logic = u_pivot_count - 1; i_logic >= 0; i_logic--) {
+      // Skip void
+      if (u_pivot_index[i_logic] == -1) continue;
+      // Normal part
+      const HighsInt pivotRow = u_pivot_index[i_logic];
+      const HighsInt start = u_start[i_logic];
+      const HighsInt end = u_end[i_logic];
+      for (HighsInt iVec = 0; iVec < num_sparse; iVec++) {
+        double* array = rhs_array[iVec];
+        double pivot_multiplier = array[pivotRow];
+        if (fabs(pivot_multiplier) > kHighsTiny) {
+          pivot_multiplier /= u_pivot_value[i_logic];
+          rhs_index[iVec][rhs_count[iVec]++] = pivotRow;
+          array[pivotRow] = pivot_multiplier;
+          if (i_logic >= num_row) rhs_synthetic_tick[iVec] += (end - start);
+          for (HighsInt k = start; k < end; k++)
+            array[u_index[k]] -= pivot_multiplier * u_value[k];
+        } else
+          array[pivotRow] = 0;
+      }
+    }
+    // Save the counts
+    for (HighsInt iVec = 0; iVec < num_sparse; iVec++) {
+      sparse_vector[iVec]->count = rhs_count[iVec];
+      sparse_vector[iVec]->synthetic_tick +=
+          rhs_synthetic_tick[iVec] * 15 + (u_pivot_count - num_row) * 10;
+    }
+    factor_timer.stop(use_clock, factor_timer_clock_pointer);
+  }
+  factor_timer.stop(FactorFtranUpper, factor_timer_clock_pointer);
+}
+
 void HFactor::btranU(HVector& rhs, const double expected_density,
                      HighsTimerClock* factor_timer_clock_pointer) const {
   FactorTimer factor_timer;
@@ -1772,7 +2330,41 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperBtranU;
-  if (sparse_solve) {
+  if (sparse_solve && useParallelTran(btran_u_level, expected_density)) {
+    factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
+    HighsInt* rhs_index = rhs.index.data();
+    double* rhs_array = rhs.array.data();
+    solveTranLevel(btran_u_level, u_pivot_index.data(), u_pivot_value.data(),
+                   u_start.data(), u_last_p.data(), u_index.data(),
+                   u_value.data(), rhs_array);
+    // The pivots from updates follow those from INVERT in the serial
+    // order, so are solved last
+    double rhs_synthetic_tick = 0;
+    const HighsInt u_pivot_count = u_pivot_index.size();
+    for (HighsInt i_logic = num_row; i_logic < u_pivot_count; i_logic++) {
+      const HighsInt pivotRow = u_pivot_index[i_logic];
+      if (pivotRow == -1) continue;
+      double value = rhs_array[pivotRow];
+      for (HighsInt k = u_start[i_logic]; k < u_last_p[i_logic]; k++)
+        value -= u_value[k] * rhs_array[u_index[k]];
+      if (fabs(value) > kHighsTiny) {
+        rhs_array[pivotRow] = value / u_pivot_value[i_logic];
+        rhs_synthetic_tick += ur_lastp[i_logic] - ur_start[i_logic];
+      } else {
+        rhs_array[pivotRow] = 0;
+      }
+    }
+    HighsInt rhs_count = 0;
+    for (HighsInt i_logic = 0; i_logic < u_pivot_count; i_logic++) {
+      const HighsInt pivotRow = u_pivot_index[i_logic];
+      if (pivotRow >= 0 && rhs_array[pivotRow])
+        rhs_index[rhs_count++] = pivotRow;
+    }
+    rhs.count = rhs_count;
+    rhs.synthetic_tick +=
+        rhs_synthetic_tick * 15 + (u_pivot_count - num_row) * 10;
+    factor_timer.stop(FactorBtranUpperSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
     // Alias to non constant
     double rhs_synthetic_tick = 0;
@@ -1782,7 +2374,7 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
     // Alias to factor U
     const HighsInt* ur_start = this->ur_start.data();
     const HighsInt* ur_end = this->ur_lastp.data();
-    const HighsInt* ur_index = this->ur_index.data();
+    const HFactorIndex* ur_index = this->ur_index.data();
     const double* ur_value = this->ur_value.data();
     // Local accumulation of RHS count
     HighsInt rhs_count = 0;
@@ -1853,7 +2445,7 @@ void HFactor::ftranFT(HVector& vector) const {
   const HighsInt pf_pivot_count = pf_pivot_index.size();
   const HighsInt* pf_pivot_index = this->pf_pivot_index.data();
   const HighsInt* pf_start = this->pf_start.data();
-  const HighsInt* pf_index = this->pf_index.data();
+  const HFactorIndex* pf_index = this->pf_index.data();
   const double* pf_value = this->pf_value.data();
   for (HighsInt i = 0; i < pf_pivot_count; i++) {
     HighsInt iRow = pf_pivot_index[i];
@@ -1877,6 +2469,52 @@ void HFactor::ftranFT(HVector& vector) const {
   }
 }
 
+void HFactor::ftranFTMulti(HVector* const* vector,
+                           const HighsInt num_vector) const {
+  // Alias to non constant
+  HighsInt rhs_count[kFtranMultiMaxNumVector];
+  HighsInt* rhs_index[kFtranMultiMaxNumVector];
+  double* rhs_array[kFtranMultiMaxNumVector];
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    assert(vector[iVec]->count >= 0);
+    rhs_count[iVec] = vector[iVec]->count;
+    rhs_index[iVec] = vector[iVec]->index.data();
+    rhs_array[iVec] = vector[iVec]->array.data();
+  }
+  // Alias to PF buffer
+  const HighsInt pf_pivot_count = pf_pivot_index.size();
+  const HighsInt* pf_pivot_index = this->pf_pivot_index.data();
+  const HighsInt* pf_start = this->pf_start.data();
+  const HFactorIndex* pf_index = this->pf_index.data();
+  const double* pf_value = this->pf_value.data();
+  for (HighsInt i = 0; i < pf_pivot_count; i++) {
+    HighsInt iRow = pf_pivot_index[i];
+    const HighsInt start = pf_start[i];
+    const HighsInt end = pf_start[i + 1];
+    for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+      double* array = rhs_array[iVec];
+      double value0 = array[iRow];
+      double value1 = value0;
+      for (HighsInt k = start; k < end; k++)
+        value1 -= array[pf_index[k]] * pf_value[k];
+      // This would skip the situation where they are both zeros
+      if (value0 || value1) {
+        if (value0 == 0) rhs_index[iVec][rhs_count[iVec]++] = iRow;
+        array[iRow] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+      }
+    }
+  }
+  // Save counts back
+  for (HighsInt iVec = 0; iVec < num_vector; iVec++) {
+    HVector& rhs = *vector[iVec];
+    rhs.count = rhs_count[iVec];
+    rhs.synthetic_tick += pf_pivot_count * 20 + pf_start[pf_pivot_count] * 5;
+    if (pf_start[pf_pivot_count] / (pf_pivot_count + 1) < 5) {
+      rhs.synthetic_tick += pf_start[pf_pivot_count] * 5;
+    }
+  }
+}
+
 void HFactor::btranFT(HVector& vector) const {
   // Alias to non constant
   assert(vector.count >= 0);
@@ -1887,7 +2525,7 @@ void HFactor::btranFT(HVector& vector) const {
   const HighsInt pf_pivot_count = pf_pivot_index.size();
   const HighsInt* pf_pivot_index = this->pf_pivot_index.data();
   const HighsInt* pf_start = this->pf_start.data();
-  const HighsInt* pf_index = this->pf_index.data();
+  const HFactorIndex* pf_index = this->pf_index.data();
   const double* pf_value = this->pf_value.data();
   // Apply row ETA backward
   double rhs_synthetic_tick = 0;
@@ -1918,7 +2556,7 @@ void HFactor::ftranPF(HVector& vector) const {
   const HighsInt* pf_pivot_index = this->pf_pivot_index.data();
   const double* pf_pivot_value = this->pf_pivot_value.data();
   const HighsInt* pf_start = this->pf_start.data();
-  const HighsInt* pf_index = this->pf_index.data();
+  const HFactorIndex* pf_index = this->pf_index.data();
   const double* pf_value = this->pf_value.data();
 
   // Alias to non constant
@@ -1953,7 +2591,7 @@ void HFactor::btranPF(HVector& vector) const {
   const HighsInt* pf_pivot_index = this->pf_pivot_index.data();
   const double* pf_pivot_value = this->pf_pivot_value.data();
   const HighsInt* pf_start = this->pf_start.data();
-  const HighsInt* pf_index = this->pf_index.data();
+  const HFactorIndex* pf_index = this->pf_index.data();
   const double* pf_value = this->pf_value.data();
 
   // Alias to non constant
@@ -2509,10 +3147,10 @@ InvertibleRepresentation HFactor::getInvert() const {
   invert.l_pivot_index = this->l_pivot_index;
   invert.l_pivot_lookup = this->l_pivot_lookup;
   invert.l_start = this->l_start;
-  invert.l_index = this->l_index;
+  invert.l_index.assign(this->l_index.begin(), this->l_index.end());
   invert.l_value = this->l_value;
   invert.lr_start = this->lr_start;
-  invert.lr_index = this->lr_index;
+  invert.lr_index.assign(this->lr_index.begin(), this->lr_index.end());
   invert.lr_value = this->lr_value;
 
   invert.u_pivot_lookup = this->u_pivot_lookup;
@@ -2520,19 +3158,23 @@ InvertibleRepresentation HFactor::getInvert() const {
   invert.u_pivot_value = this->u_pivot_value;
   invert.u_start = this->u_start;
   invert.u_last_p = this->u_last_p;
-  invert.u_index = this->u_index;
+  invert.u_index.assign(this->u_index.begin(), this->u_index.end());
   invert.u_value = this->u_value;
 
   invert.ur_start = this->ur_start;
   invert.ur_lastp = this->ur_lastp;
   invert.ur_space = this->ur_space;
-  invert.ur_index = this->ur_index;
+  invert.ur_index.assign(this->ur_index.begin(), this->ur_index.end());
   invert.ur_value = this->ur_value;
   invert.pf_start = this->pf_start;
-  invert.pf_index = this->pf_index;
+  invert.pf_index.assign(this->pf_index.begin(), this->pf_index.end());
   invert.pf_value = this->pf_value;
   invert.pf_pivot_index = this->pf_pivot_index;
   invert.pf_pivot_value = this->pf_pivot_value;
+  invert.ftran_l_level = this->ftran_l_level;
+  invert.btran_l_level = this->btran_l_level;
+  invert.ftran_u_level = this->ftran_u_level;
+  invert.btran_u_level = this->btran_u_level;
   return invert;
 }
 
@@ -2540,10 +3182,10 @@ void HFactor::setInvert(const InvertibleRepresentation& invert) {
   this->l_pivot_index = invert.l_pivot_index;
   this->l_pivot_lookup = invert.l_pivot_lookup;
   this->l_start = invert.l_start;
-  this->l_index = invert.l_index;
+  this->l_index.assign(invert.l_index.begin(), invert.l_index.end());
   this->l_value = invert.l_value;
   this->lr_start = invert.lr_start;
-  this->lr_index = invert.lr_index;
+  this->lr_index.assign(invert.lr_index.begin(), invert.lr_index.end());
   this->lr_value = invert.lr_value;
 
   this->u_pivot_lookup = invert.u_pivot_lookup;
@@ -2551,19 +3193,37 @@ void HFactor::setInvert(const InvertibleRepresentation& invert) {
   this->u_pivot_value = invert.u_pivot_value;
   this->u_start = invert.u_start;
   this->u_last_p = invert.u_last_p;
-  this->u_index = invert.u_index;
+  this->u_index.assign(invert.u_index.begin(), invert.u_index.end());
   this->u_value = invert.u_value;
 
   this->ur_start = invert.ur_start;
   this->ur_lastp = invert.ur_lastp;
   this->ur_space = invert.ur_space;
-  this->ur_index = invert.ur_index;
+  this->ur_index.assign(invert.ur_index.begin(), invert.ur_index.end());
   this->ur_value = invert.ur_value;
   this->pf_start = invert.pf_start;
-  this->pf_index = invert.pf_index;
+  this->pf_index.assign(invert.pf_index.begin(), invert.pf_index.end());
   this->pf_value = invert.pf_value;
   this->pf_pivot_index = invert.pf_pivot_index;
   this->pf_pivot_value = invert.pf_pivot_value;
+
+  // Restore the levels for dense TRANs in parallel, since updates may
+  // have changed U so that they cannot be rebuilt. If the INVERT was
+  // got without levels, they can be built only if U has no updates
+  this->clearTranLevels();
+  if (!parallel_tran_) return;
+  this->ftran_l_level = invert.ftran_l_level;
+  this->btran_l_level = invert.btran_l_level;
+  this->ftran_u_level = invert.ftran_u_level;
+  this->btran_u_level = invert.btran_u_level;
+  if (!hasParallelTranLevels() && (HighsInt)u_pivot_index.size() == num_row)
+    buildTranLevels();
+}
+
+void HFactorTranLevel::clear() {
+  this->parallel = false;
+  this->start.clear();
+  this->pivot.clear();
 }
 
 void InvertibleRepresentation::clear() {
@@ -2594,4 +3254,8 @@ void InvertibleRepresentation::clear() {
   this->pf_value.clear();
   this->pf_pivot_index.clear();
   this->pf_pivot_value.clear();
+  this->ftran_l_level.clear();
+  this->btran_l_level.clear();
+  this->ftran_u_level.clear();
+  this->btran_u_level.clear();
 }
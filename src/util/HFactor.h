@@ -31,7 +31,19 @@ using std::max;
 using std::vector;
 
 const HighsInt kBuildKernelReturnTimeout = -1;
+const HighsInt kSetupReturnIndexOverflow = -1;
+
+// Levels of the pivots of L or U for dense TRANs in parallel: the
+// pivots in each level depend only on pivots in earlier levels
+struct HFactorTranLevel {
+  bool parallel = false;
+  std::vector<HighsInt> start;
+  std::vector<HighsInt> pivot;
+  void clear();
+};
 
+// The indices of an INVERT are held as HighsInt, and converted from
+// and to the HFactorIndex used internally by getInvert and setInvert
 struct InvertibleRepresentation {
   // Factor L
   std::vector<HighsInt> l_pivot_index;
@@ -64,6 +76,12 @@ struct InvertibleRepresentation {
   std::vector<double> pf_value;
   std::vector<HighsInt> pf_pivot_index;
   std::vector<double> pf_pivot_value;
+
+  // Levels for dense TRANs in parallel, if they were built by INVERT
+  HFactorTranLevel ftran_l_level;
+  HFactorTranLevel btran_l_level;
+  HFactorTranLevel ftran_u_level;
+  HFactorTranLevel btran_u_level;
   void clear();
 };
 
@@ -113,38 +131,44 @@ class HFactor {
    * working buffer for INVERT, allocate space for basis matrix, L, U
    * factor and Update buffer, allocated space for Markowitz matrices,
    * count-link-list, L factor and U factor
+   *
+   * Returns kSetupReturnIndexOverflow if the dimensions of the basis
+   * matrix do not fit into HFactorIndex, which is only possible if
+   * HFACTOR_INDEX32 is set in a HIGHSINT64 build, and 0 otherwise
    */
 
-  void setup(const HighsSparseMatrix& a_matrix,
-             std::vector<HighsInt>& basic_index,
-             const double pivot_threshold = kDefaultPivotThreshold,
-             const double pivot_tolerance = kDefaultPivotTolerance,
-             const HighsInt highs_debug_level = kHighsDebugLevelMin,
-             const HighsLogOptions* log_options = NULL);
-
-  void setupGeneral(const HighsSparseMatrix* a_matrix, HighsInt num_basic,
-                    HighsInt* basic_index,
-                    const double pivot_threshold = kDefaultPivotThreshold,
-                    const double pivot_tolerance = kDefaultPivotTolerance,
-                    const HighsInt highs_debug_level = kHighsDebugLevelMin,
-                    const HighsLogOptions* log_options = NULL);
-
-  void setup(const HighsInt num_col,   //!< Number of columns
-             const HighsInt num_row,   //!< Number of rows
-             const HighsInt* a_start,  //!< Column starts of constraint matrix
-             const HighsInt* a_index,  //!< Row indices of constraint matrix
-             const double* a_value,    //!< Row values of constraint matrix
-             HighsInt* basic_index,    //!< Indices of basic variables
-             const double pivot_threshold =
-                 kDefaultPivotThreshold,  //!< Pivoting threshold
-             const double pivot_tolerance =
-                 kDefaultPivotTolerance,  //!< Min absolute pivot
-             const HighsInt highs_debug_level = kHighsDebugLevelMin,
-             const HighsLogOptions* log_options = NULL,
-             const bool use_original_HFactor_logic = true,
-             const HighsInt update_method = kUpdateMethodFt);
-
-  void setupGeneral(
+  HighsInt setup(const HighsSparseMatrix& a_matrix,
+                 std::vector<HighsInt>& basic_index,
+                 const double pivot_threshold = kDefaultPivotThreshold,
+                 const double pivot_tolerance = kDefaultPivotTolerance,
+                 const HighsInt highs_debug_level = kHighsDebugLevelMin,
+                 const HighsLogOptions* log_options = NULL);
+
+  HighsInt setupGeneral(
+      const HighsSparseMatrix* a_matrix, HighsInt num_basic,
+      HighsInt* basic_index,
+      const double pivot_threshold = kDefaultPivotThreshold,
+      const double pivot_tolerance = kDefaultPivotTolerance,
+      const HighsInt highs_debug_level = kHighsDebugLevelMin,
+      const HighsLogOptions* log_options = NULL);
+
+  HighsInt setup(
+      const HighsInt num_col,   //!< Number of columns
+      const HighsInt num_row,   //!< Number of rows
+      const HighsInt* a_start,  //!< Column starts of constraint matrix
+      const HighsInt* a_index,  //!< Row indices of constraint matrix
+      const double* a_value,    //!< Row values of constraint matrix
+      HighsInt* basic_index,    //!< Indices of basic variables
+      const double pivot_threshold =
+          kDefaultPivotThreshold,  //!< Pivoting threshold
+      const double pivot_tolerance =
+          kDefaultPivotTolerance,  //!< Min absolute pivot
+      const HighsInt highs_debug_level = kHighsDebugLevelMin,
+      const HighsLogOptions* log_options = NULL,
+      const bool use_original_HFactor_logic = true,
+      const HighsInt update_method = kUpdateMethodFt);
+
+  HighsInt setupGeneral(
       const HighsInt num_col,    //!< Number of columns
       const HighsInt num_row,    //!< Number of rows
       const HighsInt num_basic,  //!< Number of indices in basic_index
@@ -186,6 +210,18 @@ class HFactor {
   void ftranCall(std::vector<double>& vector,
                  HighsTimerClock* factor_timer_clock_pointer = NULL);
 
+  /**
+   * @brief Solve \f$B\mathbf{x}=\mathbf{b}\f$ (FTRAN) for several RHS
+   * vectors, applying each pivot of L, U and the update etas to all
+   * the vectors whose solve is not hyper-sparse. The results are
+   * identical to those of ftranCall
+   */
+  void ftranMulti(
+      HVector* const* vector,          //!< RHS vectors \f$\mathbf{b}\f$
+      const HighsInt num_vector,       //!< Number of RHS vectors
+      const double* expected_density,  //!< Expected density of each result
+      HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
   /**
    * @brief Solve \f$B^T\mathbf{x}=\mathbf{b}\f$ (BTRAN)
    */
@@ -197,6 +233,13 @@ class HFactor {
   void btranCall(std::vector<double>& vector,
                  HighsTimerClock* factor_timer_clock_pointer = NULL);
 
+  /**
+   * @brief The style of the triangular solves that btranCall chooses
+   * on the basis of the expected density. BTRANs of the same RHS with
+   * expected densities of the same style give identical results
+   */
+  HighsInt btranStyle(const double expected_density) const;
+
   /**
    * @brief Update according to
    * \f$B'=B+(\mathbf{a}_q-B\mathbf{e}_p)\mathbf{e}_p^T\f$
@@ -295,6 +338,23 @@ class HFactor {
   InvertibleRepresentation getInvert() const;
   void setInvert(const InvertibleRepresentation& invert);
 
+  /**
+   * @brief Sets whether dense TRANs with L and U may be performed in
+   * parallel over the levels of independent pivots found by build()
+   */
+  void setParallelTran(const bool parallel_tran) {
+    this->parallel_tran_ = parallel_tran;
+  }
+
+  /**
+   * @brief Returns whether there are levels of L or U that are wide
+   * enough for dense TRANs to be performed in parallel
+   */
+  bool hasParallelTranLevels() const {
+    return ftran_l_level.parallel || btran_l_level.parallel ||
+           ftran_u_level.parallel || btran_u_level.parallel;
+  }
+
   void setDebugReport(const bool debug_report) {
     this->debug_report_ = debug_report;
   }
@@ -340,6 +400,7 @@ class HFactor {
 
   bool use_original_HFactor_logic;
   bool debug_report_ = false;
+  bool parallel_tran_ = false;
   HighsInt basis_matrix_limit_size;
   HighsInt update_method;
 
@@ -354,7 +415,7 @@ class HFactor {
   // Basis matrix
   vector<HighsInt> b_var;  // Temp
   vector<HighsInt> b_start;
-  vector<HighsInt> b_index;
+  vector<HFactorIndex> b_index;
   vector<double> b_value;
 
   // Permutation
@@ -366,7 +427,7 @@ class HFactor {
   vector<HighsInt> mc_count_a;
   vector<HighsInt> mc_count_n;
   vector<HighsInt> mc_space;
-  vector<HighsInt> mc_index;
+  vector<HFactorIndex> mc_index;
   vector<double> mc_value;
   vector<double> mc_min_pivot;
 
@@ -375,13 +436,29 @@ class HFactor {
   vector<HighsInt> mr_count;
   vector<HighsInt> mr_space;
   vector<HighsInt> mr_count_before;
-  vector<HighsInt> mr_index;
+  vector<HFactorIndex> mr_index;
 
   // Kernel column buffer
   vector<HighsInt> mwz_column_index;
   vector<char> mwz_column_mark;
   vector<double> mwz_column_array;
 
+  // Parallel elimination of the kernel: the outcome of updating each
+  // column of the pivotal row, and the row marks and buffers of
+  // cancelled and fill-in rows of each worker
+  struct KernelColumnUpdate {
+    double pivot;
+    double max_value;
+    HighsInt count;
+    HighsInt worker;
+    HighsInt start;
+    HighsInt num_cancel;
+    HighsInt num_fill;
+  };
+  vector<KernelColumnUpdate> kernel_column_update;
+  vector<vector<char>> worker_row_mark;
+  vector<vector<HighsInt>> worker_row_buffer;
+
   // Count link list
   vector<HighsInt> col_link_first;
   vector<HighsInt> col_link_next;
@@ -396,10 +473,10 @@ class HFactor {
   vector<HighsInt> l_pivot_index;
 
   vector<HighsInt> l_start;
-  vector<HighsInt> l_index;
+  vector<HFactorIndex> l_index;
   vector<double> l_value;
   vector<HighsInt> lr_start;
-  vector<HighsInt> lr_index;
+  vector<HFactorIndex> lr_index;
   vector<double> lr_value;
 
   // Factor U
@@ -411,27 +488,50 @@ class HFactor {
   HighsInt u_total_x;  // Only in PF and MPF
   vector<HighsInt> u_start;
   vector<HighsInt> u_last_p;
-  vector<HighsInt> u_index;
+  vector<HFactorIndex> u_index;
   vector<double> u_value;
   vector<HighsInt> ur_start;
   vector<HighsInt> ur_lastp;
   vector<HighsInt> ur_space;
-  vector<HighsInt> ur_index;
+  vector<HFactorIndex> ur_index;
   vector<double> ur_value;
 
   // Update buffer
   vector<double> pf_pivot_value;
   vector<HighsInt> pf_pivot_index;
   vector<HighsInt> pf_start;
-  vector<HighsInt> pf_index;
+  vector<HFactorIndex> pf_index;
   vector<double> pf_value;
 
+  // Levels of the pivots of L and U for dense TRANs in parallel
+  HFactorTranLevel ftran_l_level;
+  HFactorTranLevel btran_l_level;
+  HFactorTranLevel ftran_u_level;
+  HFactorTranLevel btran_u_level;
+
   HVector rhs_;
 
   // Implementation
   void buildSimple();
   //    void buildKernel();
   HighsInt buildKernel();
+  bool kernelParallelEliminate(const HighsInt pivot_row_count,
+                               const HighsInt mwz_column_count) const;
+  double buildKernelParallelEliminate(const HighsInt iRowPivot,
+                                      const HighsInt mwz_column_count);
+  void buildTranLevels();
+  void buildTranLevel(HFactorTranLevel& level, const bool forward,
+                      const HighsInt* pivot_index, const HighsInt* lookup,
+                      const HighsInt* dep_start, const HighsInt* dep_end,
+                      const HFactorIndex* dep_index);
+  void clearTranLevels();
+  bool useParallelTran(const HFactorTranLevel& level,
+                       const double expected_density) const;
+  void solveTranLevel(const HFactorTranLevel& level,
+                      const HighsInt* pivot_index, const double* pivot_value,
+                      const HighsInt* dep_start, const HighsInt* dep_end,
+                      const HFactorIndex* dep_index, const double* dep_value,
+                      double* rhs_array) const;
   void buildHandleRankDeficiency();
   void buildReportRankDeficiency();
   void buildMarkSingC();
@@ -446,6 +546,8 @@ class HFactor {
 
   void reportIntVector(const std::string name,
                        const vector<HighsInt> entry) const;
+  void reportIndexVector(const std::string name,
+                         const vector<HFactorIndex> entry) const;
   void reportDoubleVector(const std::string name,
                           const vector<double> entry) const;
 
@@ -457,8 +559,15 @@ class HFactor {
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void btranU(HVector& vector, const double expected_density,
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void ftranLMulti(HVector* const* vector, const HighsInt num_vector,
+                   const double* expected_density,
+                   HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void ftranUMulti(HVector* const* vector, const HighsInt num_vector,
+                   const double* expected_density,
+                   HighsTimerClock* factor_timer_clock_pointer = NULL) const;
 
   void ftranFT(HVector& vector) const;
+  void ftranFTMulti(HVector* const* vector, const HighsInt num_vector) const;
   void btranFT(HVector& vector) const;
   void ftranPF(HVector& vector) const;
   void btranPF(HVector& vector) const;
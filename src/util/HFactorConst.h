@@ -16,6 +16,18 @@
 
 #include "util/HighsInt.h"
 
+// Type of the row and column indices of the entries in the basis
+// matrix, its factors and their updates. This is HighsInt unless
+// HFACTOR_INDEX32 is set in a HIGHSINT64 build, when they are 32-bit,
+// halving the storage that they require, and HFactor::setup fails if
+// the dimensions of the basis matrix do not fit into 32 bits.
+// InvertibleRepresentation holds them as HighsInt
+#if defined(HIGHSINT64) && defined(HFACTOR_INDEX32)
+typedef int32_t HFactorIndex;
+#else
+typedef HighsInt HFactorIndex;
+#endif
+
 enum UPDATE_METHOD {
   kUpdateMethodFt = 1,
   kUpdateMethodPf = 2,
@@ -53,6 +65,29 @@ const double kHyperCancel = 0.05;
  */
 const double kHyperResult = 0.10;
 
+/**
+ * Maximum number of RHS vectors that can be solved in one pass over
+ * the factors by HFactor::ftranMulti
+ */
+const HighsInt kFtranMultiMaxNumVector = 4;
+
+/**
+ * Minimum dimension and average number of pivots per level for the
+ * dense TRANs with L or U to be performed in parallel over levels,
+ * and the minimum expected density of the result
+ */
+const HighsInt kParallelTranMinDim = 1000;
+const HighsInt kParallelTranMinLevelWidth = 64;
+const double kParallelTranMinDensity = 0.3;
+
+/**
+ * Minimum number of columns in the pivotal row, and of entries in
+ * these columns to be updated, for the elimination of a kernel pivot
+ * to be performed in parallel
+ */
+const HighsInt kKernelParallelMinCount = 32;
+const double kKernelParallelMinWork = 16384;
+
 /**
  * Parameters for reinversion on synthetic clock
  */
@@ -31,7 +31,7 @@ void debugReportRankDeficiency(
 void debugReportRankDeficientASM(
     const HighsInt highs_debug_level, const HighsLogOptions& log_options,
     const HighsInt num_row, const vector<HighsInt>& mc_start,
-    const vector<HighsInt>& mc_count_a, const vector<HighsInt>& mc_index,
+    const vector<HighsInt>& mc_count_a, const vector<HFactorIndex>& mc_index,
     const vector<double>& mc_value, const vector<HighsInt>& iwork,
     const HighsInt rank_deficiency, const vector<HighsInt>& col_with_no_pivot,
     const vector<HighsInt>& row_with_no_pivot);
@@ -28,11 +28,11 @@ void HFactor::reportLu(const HighsInt l_u_or_both, const bool full) const {
     if (full) reportIntVector("l_pivot_lookup", l_pivot_lookup);
     if (full) reportIntVector("l_pivot_index", l_pivot_index);
     reportIntVector("l_start", l_start);
-    reportIntVector("l_index", l_index);
+    reportIndexVector("l_index", l_index);
     reportDoubleVector("l_value", l_value);
     if (full) {
       reportIntVector("lr_start", lr_start);
-      reportIntVector("lr_index", lr_index);
+      reportIndexVector("lr_index", lr_index);
       reportDoubleVector("lr_value", lr_value);
     }
   }
@@ -45,7 +45,7 @@ void HFactor::reportLu(const HighsInt l_u_or_both, const bool full) const {
     reportDoubleVector("u_pivot_value", u_pivot_value);
     reportIntVector("u_start", u_start);
     if (full) reportIntVector("u_last_p", u_last_p);
-    reportIntVector("u_index", u_index);
+    reportIndexVector("u_index", u_index);
     reportDoubleVector("u_value", u_value);
     if (full) {
       reportIntVector("ur_start", ur_start);
@@ -71,7 +71,7 @@ void HFactor::reportLu(const HighsInt l_u_or_both, const bool full) const {
     reportDoubleVector("pf_pivot_value", pf_pivot_value);
     reportIntVector("pf_pivot_index", pf_pivot_index);
     reportIntVector("pf_start", pf_start);
-    reportIntVector("pf_index", pf_index);
+    reportIndexVector("pf_index", pf_index);
     reportDoubleVector("pf_value", pf_value);
   }
 }
@@ -88,6 +88,18 @@ void HFactor::reportIntVector(const std::string name,
   }
   printf("\n");
 }
+void HFactor::reportIndexVector(const std::string name,
+                                const vector<HFactorIndex> entry) const {
+  const HighsInt num_en = entry.size();
+  printf("%-12s: siz %4d; cap %4d: ", name.c_str(), (int)num_en,
+         (int)entry.capacity());
+  for (HighsInt iEn = 0; iEn < num_en; iEn++) {
+    if (iEn > 0 && iEn % 10 == 0)
+      printf("\n                                  ");
+    printf("%11d ", (int)entry[iEn]);
+  }
+  printf("\n");
+}
 void HFactor::reportDoubleVector(const std::string name,
                                  const vector<double> entry) const {
   const HighsInt num_en = entry.size();
@@ -20,6 +20,7 @@
 #include "lp_data/HConst.h"
 #include "stdio.h"  //Just for temporary printf
 #include "util/HighsCDouble.h"
+#include "util/HighsSimd.h"
 
 template <typename Real>
 void HVectorBase<Real>::setup(HighsInt size_) {
@@ -173,6 +174,22 @@ Real HVectorBase<Real>::norm2() const {
   return result;
 }
 
+// When all the real types are double, saxpy can use the SIMD kernel
+static bool saxpySimd(HighsInt& workCount, HighsInt* workIndex,
+                      double* workArray, const double pivotX,
+                      const HighsInt pivotCount, const HighsInt* pivotIndex,
+                      const double* pivotArray) {
+  workCount = highsSimdSaxpy(workCount, workIndex, workArray, pivotX,
+                             pivotCount, pivotIndex, pivotArray);
+  return true;
+}
+
+template <typename Real, typename RealPiv, typename RealPivX>
+static bool saxpySimd(HighsInt&, HighsInt*, Real*, const RealPivX,
+                      const HighsInt, const HighsInt*, const RealPiv*) {
+  return false;
+}
+
 template <typename Real>
 template <typename RealPivX, typename RealPiv>
 void HVectorBase<Real>::saxpy(const RealPivX pivotX,
@@ -191,6 +208,12 @@ void HVectorBase<Real>::saxpy(const RealPivX pivotX,
   const HighsInt* pivotIndex = &pivot->index[0];
   const RealPiv* pivotArray = &pivot->array[0];
 
+  if (saxpySimd(workCount, workIndex, workArray, pivotX, pivotCount,
+                pivotIndex, pivotArray)) {
+    count = workCount;
+    return;
+  }
+
   using std::abs;
   for (HighsInt k = 0; k < pivotCount; k++) {
     const HighsInt iRow = pivotIndex[k];
@@ -0,0 +1,91 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HVectorPool.cpp
+ * @brief
+ */
+#include "util/HVectorPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+HVectorPool& HVectorPool::threadPool() {
+  static thread_local HVectorPool pool;
+  return pool;
+}
+
+HVector* HVectorPool::checkout(const HighsInt size) {
+  // Choose the free vector that can be set up with the given size
+  // using the least storage, preferring one of exactly that size
+  // since it only needs to be cleared
+  HighsInt use_free = -1;
+  size_t use_capacity = 0;
+  for (HighsInt iFree = 0; iFree < (HighsInt)free_.size(); iFree++) {
+    const HVector& vector = *free_[iFree];
+    if (vector.size == size) {
+      use_free = iFree;
+      break;
+    }
+    const size_t capacity = vector.array.capacity();
+    if (capacity < (size_t)size) continue;
+    if (use_free < 0 || capacity < use_capacity) {
+      use_free = iFree;
+      use_capacity = capacity;
+    }
+  }
+  HVector* vector;
+  if (use_free >= 0) {
+    vector = free_[use_free];
+    free_[use_free] = free_.back();
+    free_.pop_back();
+    if (vector->size == size) {
+      vector->clear();
+      return vector;
+    }
+  } else if (!free_.empty()) {
+    // No free vector is large enough, so grow the largest
+    std::vector<HVector*>::iterator largest = std::max_element(
+        free_.begin(), free_.end(), [](const HVector* a, const HVector* b) {
+          return a->array.capacity() < b->array.capacity();
+        });
+    vector = *largest;
+    *largest = free_.back();
+    free_.pop_back();
+    num_allocation_++;
+  } else {
+    vector_.emplace_back(new HVector());
+    vector = vector_.back().get();
+    num_allocation_++;
+  }
+  vector->setup(size);
+  return vector;
+}
+
+void HVectorPool::checkin(HVector* vector) {
+  assert(std::find(free_.begin(), free_.end(), vector) == free_.end());
+  // Reserving for all vectors means that returning one never
+  // allocates
+  if (free_.capacity() < vector_.size()) free_.reserve(vector_.size());
+  free_.push_back(vector);
+}
+
+void HVectorPool::clear() {
+  for (HVector* vector : free_) {
+    std::vector<std::unique_ptr<HVector>>::iterator owner =
+        std::find_if(vector_.begin(), vector_.end(),
+                     [vector](const std::unique_ptr<HVector>& item) {
+                       return item.get() == vector;
+                     });
+    assert(owner != vector_.end());
+    *owner = std::move(vector_.back());
+    vector_.pop_back();
+  }
+  free_.clear();
+}
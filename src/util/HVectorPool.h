@@ -0,0 +1,70 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HVectorPool.h
+ * @brief Per-thread pool of HVector work buffers
+ *
+ * Temporary HVector instances of full dimension are checked out of
+ * the pool of the calling thread and returned to it when no longer
+ * needed, so that repeated calls reuse the storage of earlier ones
+ * rather than going to the heap.
+ */
+#ifndef UTIL_HVECTORPOOL_H_
+#define UTIL_HVECTORPOOL_H_
+
+#include <memory>
+#include <vector>
+
+#include "util/HVector.h"
+
+class HVectorPool {
+ public:
+  /// The pool of the calling thread
+  static HVectorPool& threadPool();
+
+  /// Check out a vector of the given size, with zero values and no
+  /// nonzeros, as if HVector::setup had just been called
+  HVector* checkout(const HighsInt size);
+  /// Return a vector that was checked out of this pool
+  void checkin(HVector* vector);
+  /// Free the storage of all vectors that are not checked out
+  void clear();
+
+  HighsInt numVector() const { return (HighsInt)vector_.size(); }
+  HighsInt numFree() const { return (HighsInt)free_.size(); }
+  /// Number of times that checkout has had to go to the heap
+  HighsInt numAllocation() const { return num_allocation_; }
+
+ private:
+  std::vector<std::unique_ptr<HVector>> vector_;
+  std::vector<HVector*> free_;
+  HighsInt num_allocation_ = 0;
+};
+
+/// Holds a vector checked out of a pool for the lifetime of the
+/// scope in which it is declared
+class PooledHVector {
+ public:
+  explicit PooledHVector(const HighsInt size,
+                         HVectorPool& pool = HVectorPool::threadPool())
+      : pool_(pool), vector_(pool.checkout(size)) {}
+  ~PooledHVector() { pool_.checkin(vector_); }
+  PooledHVector(const PooledHVector&) = delete;
+  PooledHVector& operator=(const PooledHVector&) = delete;
+
+  HVector& operator*() { return *vector_; }
+  HVector* operator->() { return vector_; }
+
+ private:
+  HVectorPool& pool_;
+  HVector* vector_;
+};
+
+#endif /* UTIL_HVECTORPOOL_H_ */
@@ -0,0 +1,466 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.cpp
+ * @brief
+ */
+#include "util/HighsSimd.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "lp_data/HConst.h"
+#include "util/HighsCDouble.h"
+
+// The vector kernels gather with 32-bit indices
+#if defined(HIGHS_HAVE_AVX_DISPATCH) && !defined(HIGHSINT64)
+#define HIGHS_SIMD_KERNELS
+#include <immintrin.h>
+#define HIGHS_TARGET_AVX2 __attribute__((target("avx2")))
+#define HIGHS_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+HighsSimdLevel highsSimdLevel() {
+#ifdef HIGHS_SIMD_KERNELS
+  static const HighsSimdLevel level = []() -> HighsSimdLevel {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return HighsSimdLevel::kAvx512;
+    if (__builtin_cpu_supports("avx2")) return HighsSimdLevel::kAvx2;
+    return HighsSimdLevel::kNone;
+  }();
+  return level;
+#else
+  return HighsSimdLevel::kNone;
+#endif
+}
+
+// The scalar kernels are the loops that the vector kernels replace,
+// and also finish the entries beyond the last full vector
+
+static HighsInt saxpyScalar(HighsInt count, HighsInt* index, double* array,
+                            const double multiplier, const HighsInt from_k,
+                            const HighsInt pivot_count,
+                            const HighsInt* pivot_index,
+                            const double* pivot_array) {
+  for (HighsInt k = from_k; k < pivot_count; k++) {
+    const HighsInt iRow = pivot_index[k];
+    const double x0 = array[iRow];
+    const double x1 = x0 + multiplier * pivot_array[iRow];
+    if (x0 == 0) index[count++] = iRow;
+    array[iRow] = (std::fabs(x1) < kHighsTiny) ? kHighsZero : x1;
+  }
+  return count;
+}
+
+static HighsInt selectPossibleScalar(HighsInt num_possible, const HighsInt from,
+                                     const HighsInt count,
+                                     const HighsInt* index,
+                                     const double* value, const int8_t* move,
+                                     const double move_out,
+                                     const double tolerance,
+                                     HighsInt* position) {
+  for (HighsInt i = from; i < count; i++) {
+    const double alpha = value[i] * move_out * move[index[i]];
+    if (alpha > tolerance) position[num_possible++] = i;
+  }
+  return num_possible;
+}
+
+static double updateDualScalar(double dual_objective_change,
+                               const HighsInt from, const HighsInt count,
+                               const HighsInt* index, const double* value,
+                               const double theta, double* dual,
+                               const double* work_value,
+                               const int8_t* nonbasic_flag,
+                               const double cost_scale) {
+  for (HighsInt i = from; i < count; i++) {
+    const HighsInt iCol = index[i];
+    const double delta_dual = theta * value[i];
+    dual[iCol] -= delta_dual;
+    double local_dual_objective_change =
+        nonbasic_flag[iCol] * (-work_value[iCol] * delta_dual);
+    local_dual_objective_change *= cost_scale;
+    dual_objective_change += local_dual_objective_change;
+  }
+  return dual_objective_change;
+}
+
+static void breakpointTightScalar(const HighsInt from, const HighsInt to,
+                                  const std::pair<HighsInt, double>* data,
+                                  const int8_t* move, const double* dual,
+                                  const double theta, int8_t* tight) {
+  for (HighsInt i = from; i < to; i++) {
+    const HighsInt iCol = data[i].first;
+    tight[i] = move[iCol] * dual[iCol] <= theta * data[i].second;
+  }
+}
+
+static void columnDotScalar(const HighsInt from_col, const HighsInt to_col,
+                            const HighsInt* start, const HighsInt* index,
+                            const double* value, const double* x,
+                            const bool quad_precision, double* dot) {
+  for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+    if (quad_precision) {
+      HighsCDouble quad_value = 0.0;
+      for (HighsInt iEl = start[iCol]; iEl < start[iCol + 1]; iEl++)
+        quad_value += x[index[iEl]] * value[iEl];
+      *dot++ = (double)quad_value;
+    } else {
+      double sum = 0;
+      for (HighsInt iEl = start[iCol]; iEl < start[iCol + 1]; iEl++)
+        sum += x[index[iEl]] * value[iEl];
+      *dot++ = sum;
+    }
+  }
+}
+
+#ifdef HIGHS_SIMD_KERNELS
+
+// Gathers are given a zero source and a full mask, since GCC warns
+// that the undefined source of the unmasked gathers may be used
+// uninitialized
+
+HIGHS_TARGET_AVX2 static inline __m256d gatherAvx2(const double* base,
+                                                   const __m128i index) {
+  const __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, index, mask, 8);
+}
+
+HIGHS_TARGET_AVX512 static inline __m512d gatherAvx512(const double* base,
+                                                       const __m256i index) {
+  return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xFF, index, base, 8);
+}
+
+// The kernels that add a product to a value only have AVX2 versions.
+// AVX2 does not imply FMA support, whereas AVX-512 does, so the
+// compiler could contract their arithmetic into fused multiply-adds,
+// changing the results
+
+HIGHS_TARGET_AVX2 static HighsInt saxpyAvx2(HighsInt count, HighsInt* index,
+                                            double* array,
+                                            const double multiplier,
+                                            const HighsInt pivot_count,
+                                            const HighsInt* pivot_index,
+                                            const double* pivot_array) {
+  const __m256d multiplier4 = _mm256_set1_pd(multiplier);
+  const __m256d tiny4 = _mm256_set1_pd(kHighsTiny);
+  const __m256d zero_value4 = _mm256_set1_pd(kHighsZero);
+  const __m256d sign4 = _mm256_set1_pd(-0.0);
+  const __m256d zero4 = _mm256_setzero_pd();
+  alignas(32) double x1[4];
+  HighsInt k = 0;
+  for (; k + 4 <= pivot_count; k += 4) {
+    const __m128i iRow4 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pivot_index + k));
+    const __m256d x0_4 = gatherAvx2(array, iRow4);
+    const __m256d pivot4 = gatherAvx2(pivot_array, iRow4);
+    __m256d x1_4 = _mm256_add_pd(x0_4, _mm256_mul_pd(multiplier4, pivot4));
+    const __m256d small4 =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign4, x1_4), tiny4, _CMP_LT_OQ);
+    x1_4 = _mm256_blendv_pd(x1_4, zero_value4, small4);
+    _mm256_store_pd(x1, x1_4);
+    const int new_nonzero =
+        _mm256_movemask_pd(_mm256_cmp_pd(x0_4, zero4, _CMP_EQ_OQ));
+    for (HighsInt j = 0; j < 4; j++) {
+      const HighsInt iRow = pivot_index[k + j];
+      if (new_nonzero & (1 << j)) index[count++] = iRow;
+      array[iRow] = x1[j];
+    }
+  }
+  return saxpyScalar(count, index, array, multiplier, k, pivot_count,
+                     pivot_index, pivot_array);
+}
+
+// Each lane accumulates the product for one of a block of four
+// columns, walking its entries in order, so the operations on each
+// column are those of the scalar loop. Lanes whose column is
+// exhausted are masked out of the gathers and keep their sums. The
+// compensated sum repeats the two_sum of HighsCDouble::operator+=
+HIGHS_TARGET_AVX2 static void columnDotAvx2(const HighsInt from_col,
+                                            const HighsInt to_col,
+                                            const HighsInt* start,
+                                            const HighsInt* index,
+                                            const double* value,
+                                            const double* x,
+                                            const bool quad_precision,
+                                            double* dot) {
+  const __m128i one4 = _mm_set1_epi32(1);
+  alignas(32) double hi[4];
+  alignas(32) double lo[4];
+  HighsInt iCol = from_col;
+  for (; iCol + 4 <= to_col; iCol += 4) {
+    __m128i el4 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + iCol));
+    const __m128i end4 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + iCol + 1));
+    HighsInt max_count = 0;
+    for (HighsInt j = 0; j < 4; j++)
+      max_count = std::max(start[iCol + j + 1] - start[iCol + j], max_count);
+    __m256d hi4 = _mm256_setzero_pd();
+    __m256d lo4 = _mm256_setzero_pd();
+    for (HighsInt k = 0; k < max_count; k++) {
+      const __m128i active4 = _mm_cmpgt_epi32(end4, el4);
+      const __m256d mask4 =
+          _mm256_castsi256_pd(_mm256_cvtepi32_epi64(active4));
+      const __m128i iRow4 =
+          _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                   reinterpret_cast<const int*>(index), el4,
+                                   active4, 4);
+      const __m256d value4 = _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                                      value, el4, mask4, 8);
+      const __m256d x4 =
+          _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, iRow4, mask4, 8);
+      const __m256d product4 = _mm256_mul_pd(x4, value4);
+      if (quad_precision) {
+        const __m256d sum4 = _mm256_add_pd(product4, hi4);
+        const __m256d z4 = _mm256_sub_pd(sum4, product4);
+        const __m256d error4 =
+            _mm256_add_pd(_mm256_sub_pd(product4, _mm256_sub_pd(sum4, z4)),
+                          _mm256_sub_pd(hi4, z4));
+        lo4 = _mm256_blendv_pd(lo4, _mm256_add_pd(lo4, error4), mask4);
+        hi4 = _mm256_blendv_pd(hi4, sum4, mask4);
+      } else {
+        hi4 = _mm256_blendv_pd(hi4, _mm256_add_pd(hi4, product4), mask4);
+      }
+      el4 = _mm_add_epi32(el4, one4);
+    }
+    _mm256_store_pd(hi, hi4);
+    if (quad_precision) {
+      _mm256_store_pd(lo, lo4);
+      for (HighsInt j = 0; j < 4; j++) *dot++ = hi[j] + lo[j];
+    } else {
+      for (HighsInt j = 0; j < 4; j++) *dot++ = hi[j];
+    }
+  }
+  columnDotScalar(iCol, to_col, start, index, value, x, quad_precision, dot);
+}
+
+HIGHS_TARGET_AVX2 static HighsInt selectPossibleAvx2(
+    const HighsInt count, const HighsInt* index, const double* value,
+    const int8_t* move, const double move_out, const double tolerance,
+    HighsInt* position) {
+  const __m256d move_out4 = _mm256_set1_pd(move_out);
+  const __m256d tolerance4 = _mm256_set1_pd(tolerance);
+  HighsInt num_possible = 0;
+  HighsInt i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256d move4 =
+        _mm256_set_pd(move[index[i + 3]], move[index[i + 2]],
+                      move[index[i + 1]], move[index[i]]);
+    const __m256d alpha4 = _mm256_mul_pd(
+        _mm256_mul_pd(_mm256_loadu_pd(value + i), move_out4), move4);
+    int possible =
+        _mm256_movemask_pd(_mm256_cmp_pd(alpha4, tolerance4, _CMP_GT_OQ));
+    while (possible) {
+      position[num_possible++] = i + __builtin_ctz(possible);
+      possible &= possible - 1;
+    }
+  }
+  return selectPossibleScalar(num_possible, i, count, index, value, move,
+                              move_out, tolerance, position);
+}
+
+HIGHS_TARGET_AVX512 static HighsInt selectPossibleAvx512(
+    const HighsInt count, const HighsInt* index, const double* value,
+    const int8_t* move, const double move_out, const double tolerance,
+    HighsInt* position) {
+  const __m512d move_out8 = _mm512_set1_pd(move_out);
+  const __m512d tolerance8 = _mm512_set1_pd(tolerance);
+  const __m256i lane8 = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+  HighsInt num_possible = 0;
+  HighsInt i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m512d move8 = _mm512_set_pd(
+        move[index[i + 7]], move[index[i + 6]], move[index[i + 5]],
+        move[index[i + 4]], move[index[i + 3]], move[index[i + 2]],
+        move[index[i + 1]], move[index[i]]);
+    const __m512d alpha8 = _mm512_mul_pd(
+        _mm512_mul_pd(_mm512_loadu_pd(value + i), move_out8), move8);
+    const __mmask8 possible =
+        _mm512_cmp_pd_mask(alpha8, tolerance8, _CMP_GT_OQ);
+    if (!possible) continue;
+    // Compress the positions of the possible entries into position
+    const __m512i position8 = _mm512_castsi256_si512(
+        _mm256_add_epi32(_mm256_set1_epi32(i), lane8));
+    _mm512_mask_compressstoreu_epi32(position + num_possible, possible,
+                                     position8);
+    num_possible += __builtin_popcount(possible);
+  }
+  return selectPossibleScalar(num_possible, i, count, index, value, move,
+                              move_out, tolerance, position);
+}
+
+HIGHS_TARGET_AVX2 static double updateDualAvx2(
+    const HighsInt count, const HighsInt* index, const double* value,
+    const double theta, double* dual, const double* work_value,
+    const int8_t* nonbasic_flag, const double cost_scale) {
+  const __m256d theta4 = _mm256_set1_pd(theta);
+  const __m256d cost_scale4 = _mm256_set1_pd(cost_scale);
+  const __m256d sign4 = _mm256_set1_pd(-0.0);
+  alignas(32) double new_dual[4];
+  alignas(32) double change[4];
+  double dual_objective_change = 0;
+  HighsInt i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m128i iCol4 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(index + i));
+    const __m256d delta_dual4 =
+        _mm256_mul_pd(theta4, _mm256_loadu_pd(value + i));
+    _mm256_store_pd(new_dual,
+                    _mm256_sub_pd(gatherAvx2(dual, iCol4), delta_dual4));
+    const __m256d flag4 = _mm256_set_pd(
+        nonbasic_flag[index[i + 3]], nonbasic_flag[index[i + 2]],
+        nonbasic_flag[index[i + 1]], nonbasic_flag[index[i]]);
+    const __m256d minus_value4 =
+        _mm256_xor_pd(gatherAvx2(work_value, iCol4), sign4);
+    _mm256_store_pd(
+        change,
+        _mm256_mul_pd(
+            _mm256_mul_pd(flag4, _mm256_mul_pd(minus_value4, delta_dual4)),
+            cost_scale4));
+    for (HighsInt j = 0; j < 4; j++) {
+      dual[index[i + j]] = new_dual[j];
+      dual_objective_change += change[j];
+    }
+  }
+  return updateDualScalar(dual_objective_change, i, count, index, value, theta,
+                          dual, work_value, nonbasic_flag, cost_scale);
+}
+
+HIGHS_TARGET_AVX2 static void breakpointTightAvx2(
+    const HighsInt from, const HighsInt to,
+    const std::pair<HighsInt, double>* data, const int8_t* move,
+    const double* dual, const double theta, int8_t* tight) {
+  const __m256d theta4 = _mm256_set1_pd(theta);
+  HighsInt i = from;
+  for (; i + 4 <= to; i += 4) {
+    const __m128i iCol4 = _mm_set_epi32(data[i + 3].first, data[i + 2].first,
+                                        data[i + 1].first, data[i].first);
+    const __m256d move4 =
+        _mm256_set_pd(move[data[i + 3].first], move[data[i + 2].first],
+                      move[data[i + 1].first], move[data[i].first]);
+    const __m256d value4 = _mm256_set_pd(data[i + 3].second, data[i + 2].second,
+                                         data[i + 1].second, data[i].second);
+    const __m256d dual4 = _mm256_mul_pd(move4, gatherAvx2(dual, iCol4));
+    const int is_tight = _mm256_movemask_pd(
+        _mm256_cmp_pd(dual4, _mm256_mul_pd(theta4, value4), _CMP_LE_OQ));
+    for (HighsInt j = 0; j < 4; j++) tight[i + j] = (is_tight >> j) & 1;
+  }
+  breakpointTightScalar(i, to, data, move, dual, theta, tight);
+}
+
+HIGHS_TARGET_AVX512 static void breakpointTightAvx512(
+    const HighsInt from, const HighsInt to,
+    const std::pair<HighsInt, double>* data, const int8_t* move,
+    const double* dual, const double theta, int8_t* tight) {
+  const __m512d theta8 = _mm512_set1_pd(theta);
+  HighsInt i = from;
+  for (; i + 8 <= to; i += 8) {
+    const __m256i iCol8 = _mm256_set_epi32(
+        data[i + 7].first, data[i + 6].first, data[i + 5].first,
+        data[i + 4].first, data[i + 3].first, data[i + 2].first,
+        data[i + 1].first, data[i].first);
+    const __m512d move8 = _mm512_set_pd(
+        move[data[i + 7].first], move[data[i + 6].first],
+        move[data[i + 5].first], move[data[i + 4].first],
+        move[data[i + 3].first], move[data[i + 2].first],
+        move[data[i + 1].first], move[data[i].first]);
+    const __m512d value8 = _mm512_set_pd(
+        data[i + 7].second, data[i + 6].second, data[i + 5].second,
+        data[i + 4].second, data[i + 3].second, data[i + 2].second,
+        data[i + 1].second, data[i].second);
+    const __m512d dual8 = _mm512_mul_pd(move8, gatherAvx512(dual, iCol8));
+    const __mmask8 is_tight = _mm512_cmp_pd_mask(
+        dual8, _mm512_mul_pd(theta8, value8), _CMP_LE_OQ);
+    for (HighsInt j = 0; j < 8; j++) tight[i + j] = (is_tight >> j) & 1;
+  }
+  breakpointTightScalar(i, to, data, move, dual, theta, tight);
+}
+
+#endif
+
+HighsInt highsSimdSaxpy(HighsInt count, HighsInt* index, double* array,
+                        const double multiplier, const HighsInt pivot_count,
+                        const HighsInt* pivot_index,
+                        const double* pivot_array,
+                        const HighsSimdLevel level) {
+#ifdef HIGHS_SIMD_KERNELS
+  if (level != HighsSimdLevel::kNone && pivot_count >= kHighsSimdMinCount)
+    return saxpyAvx2(count, index, array, multiplier, pivot_count,
+                     pivot_index, pivot_array);
+#endif
+  return saxpyScalar(count, index, array, multiplier, 0, pivot_count,
+                     pivot_index, pivot_array);
+}
+
+HighsInt highsSimdSelectPossible(const HighsInt count, const HighsInt* index,
+                                 const double* value, const int8_t* move,
+                                 const double move_out,
+                                 const double tolerance, HighsInt* position,
+                                 const HighsSimdLevel level) {
+#ifdef HIGHS_SIMD_KERNELS
+  if (count >= kHighsSimdMinCount) {
+    if (level == HighsSimdLevel::kAvx512)
+      return selectPossibleAvx512(count, index, value, move, move_out,
+                                  tolerance, position);
+    if (level == HighsSimdLevel::kAvx2)
+      return selectPossibleAvx2(count, index, value, move, move_out,
+                                tolerance, position);
+  }
+#endif
+  return selectPossibleScalar(0, 0, count, index, value, move, move_out,
+                              tolerance, position);
+}
+
+double highsSimdUpdateDual(const HighsInt count, const HighsInt* index,
+                           const double* value, const double theta,
+                           double* dual, const double* work_value,
+                           const int8_t* nonbasic_flag,
+                           const double cost_scale,
+                           const HighsSimdLevel level) {
+#ifdef HIGHS_SIMD_KERNELS
+  if (level != HighsSimdLevel::kNone && count >= kHighsSimdMinCount)
+    return updateDualAvx2(count, index, value, theta, dual, work_value,
+                          nonbasic_flag, cost_scale);
+#endif
+  return updateDualScalar(0, 0, count, index, value, theta, dual, work_value,
+                          nonbasic_flag, cost_scale);
+}
+
+void highsSimdColumnDot(const HighsInt from_col, const HighsInt to_col,
+                        const HighsInt* start, const HighsInt* index,
+                        const double* value, const double* x,
+                        const bool quad_precision, double* dot,
+                        const HighsSimdLevel level) {
+#ifdef HIGHS_SIMD_KERNELS
+  if (level != HighsSimdLevel::kNone &&
+      to_col - from_col >= kHighsSimdMinCount)
+    return columnDotAvx2(from_col, to_col, start, index, value, x,
+                         quad_precision, dot);
+#endif
+  columnDotScalar(from_col, to_col, start, index, value, x, quad_precision,
+                  dot);
+}
+
+void highsSimdBreakpointTight(const HighsInt from, const HighsInt to,
+                              const std::pair<HighsInt, double>* data,
+                              const int8_t* move, const double* dual,
+                              const double theta, int8_t* tight,
+                              const HighsSimdLevel level) {
+#ifdef HIGHS_SIMD_KERNELS
+  if (to - from >= kHighsSimdMinCount) {
+    if (level == HighsSimdLevel::kAvx512)
+      return breakpointTightAvx512(from, to, data, move, dual, theta, tight);
+    if (level == HighsSimdLevel::kAvx2)
+      return breakpointTightAvx2(from, to, data, move, dual, theta, tight);
+  }
+#endif
+  breakpointTightScalar(from, to, data, move, dual, theta, tight);
+}
@@ -0,0 +1,86 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.h
+ * @brief SIMD kernels for the index-driven loops of HVector saxpy,
+ * dual simplex CHUZC and column-wise PRICE, dispatched at runtime on
+ * the instruction sets supported by the CPU
+ *
+ * Each kernel performs the same floating-point operations in the same
+ * order as the scalar loop it replaces, so results do not depend on
+ * the instruction set used.
+ */
+#ifndef UTIL_HIGHSSIMD_H_
+#define UTIL_HIGHSSIMD_H_
+
+#include <cstdint>
+#include <utility>
+
+#include "util/HighsInt.h"
+
+enum class HighsSimdLevel { kNone = 0, kAvx2, kAvx512 };
+
+/// The widest instruction set that the kernels can use on this CPU
+HighsSimdLevel highsSimdLevel();
+
+/// Below this number of entries the scalar loops are used
+const HighsInt kHighsSimdMinCount = 16;
+
+/// Adds multiplier times the pivot vector, given by the values
+/// pivot_array[pivot_index[k]], to the vector whose nonzeros are
+/// indexed by index, as HVectorBase::saxpy. Returns the new count of
+/// the vector
+HighsInt highsSimdSaxpy(HighsInt count, HighsInt* index, double* array,
+                        const double multiplier, const HighsInt pivot_count,
+                        const HighsInt* pivot_index,
+                        const double* pivot_array,
+                        const HighsSimdLevel level = highsSimdLevel());
+
+/// Writes the positions i for which value[i] * move_out *
+/// move[index[i]] exceeds tolerance to position, in increasing order,
+/// and returns their number
+HighsInt highsSimdSelectPossible(const HighsInt count, const HighsInt* index,
+                                 const double* value, const int8_t* move,
+                                 const double move_out,
+                                 const double tolerance, HighsInt* position,
+                                 const HighsSimdLevel level = highsSimdLevel());
+
+/// Subtracts theta times value[i] from dual[index[i]], and returns the
+/// sum, accumulated in order, of the resulting changes to the dual
+/// objective
+double highsSimdUpdateDual(const HighsInt count, const HighsInt* index,
+                           const double* value, const double theta,
+                           double* dual, const double* work_value,
+                           const int8_t* nonbasic_flag,
+                           const double cost_scale,
+                           const HighsSimdLevel level = highsSimdLevel());
+
+/// For from <= i < to, sets tight[i] to whether the breakpoint of
+/// data[i] is reached by a step of theta, that is, whether
+/// move[iCol] * dual[iCol] <= theta * data[i].second for iCol =
+/// data[i].first
+void highsSimdBreakpointTight(const HighsInt from, const HighsInt to,
+                              const std::pair<HighsInt, double>* data,
+                              const int8_t* move, const double* dual,
+                              const double theta, int8_t* tight,
+                              const HighsSimdLevel level = highsSimdLevel());
+
+/// For from_col <= iCol < to_col, sets dot[iCol - from_col] to the
+/// product of x with column iCol of the column-wise matrix given by
+/// start, index and value. Each product is accumulated in the order
+/// of the column's entries, in compensated (quad) precision if
+/// quad_precision is set
+void highsSimdColumnDot(const HighsInt from_col, const HighsInt to_col,
+                        const HighsInt* start, const HighsInt* index,
+                        const double* value, const double* x,
+                        const bool quad_precision, double* dot,
+                        const HighsSimdLevel level = highsSimdLevel());
+
+#endif /* UTIL_HIGHSSIMD_H_ */
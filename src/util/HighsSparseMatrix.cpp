@@ -16,9 +16,12 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
 
+#include "parallel/HighsParallel.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
+#include "util/HighsSimd.h"
 #include "util/HighsSort.h"
 #include "util/HighsSparseVectorSum.h"
 
@@ -28,6 +31,10 @@ using std::min;
 using std::swap;
 using std::vector;
 
+// Number of columns or rows handled by one task in the O(nnz) passes
+// that run in parallel
+const HighsInt kMatrixPassGrainSize = 1024;
+
 bool HighsSparseMatrix::operator==(const HighsSparseMatrix& matrix) const {
   bool equal = true;
   equal = this->format_ == matrix.format_ && equal;
@@ -823,78 +830,78 @@ void HighsSparseMatrix::scaleRow(const HighsInt row, const double rowScale) {
 
 void HighsSparseMatrix::applyScale(const HighsScale& scale) {
   assert(this->formatOk());
-  if (this->isColwise()) {
-    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++) {
-        HighsInt iRow = this->index_[iEl];
-        this->value_[iEl] *= (scale.col[iCol] * scale.row[iRow]);
-      }
-    }
-  } else {
-    for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++) {
-        HighsInt iCol = this->index_[iEl];
-        this->value_[iEl] *= (scale.col[iCol] * scale.row[iRow]);
-      }
-    }
-  }
+  // Each vector of the matrix is scaled independently, so this is done
+  // in parallel
+  const bool colwise = this->isColwise();
+  const HighsInt num_vec = colwise ? this->num_col_ : this->num_row_;
+  highs::parallel::for_each_block(
+      0, num_vec,
+      [&](HighsInt from_vec, HighsInt to_vec) {
+        for (HighsInt iVec = from_vec; iVec < to_vec; iVec++) {
+          for (HighsInt iEl = this->start_[iVec]; iEl < this->start_[iVec + 1];
+               iEl++) {
+            const HighsInt iCol = colwise ? iVec : this->index_[iEl];
+            const HighsInt iRow = colwise ? this->index_[iEl] : iVec;
+            this->value_[iEl] *= (scale.col[iCol] * scale.row[iRow]);
+          }
+        }
+      },
+      kMatrixPassGrainSize);
 }
 
 void HighsSparseMatrix::applyColScale(const HighsScale& scale) {
   assert(this->formatOk());
-  if (this->isColwise()) {
-    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        this->value_[iEl] *= scale.col[iCol];
-    }
-  } else {
-    for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++)
-        this->value_[iEl] *= scale.col[this->index_[iEl]];
-    }
-  }
+  const bool colwise = this->isColwise();
+  const HighsInt num_vec = colwise ? this->num_col_ : this->num_row_;
+  highs::parallel::for_each_block(
+      0, num_vec,
+      [&](HighsInt from_vec, HighsInt to_vec) {
+        for (HighsInt iVec = from_vec; iVec < to_vec; iVec++) {
+          for (HighsInt iEl = this->start_[iVec]; iEl < this->start_[iVec + 1];
+               iEl++) {
+            const HighsInt iCol = colwise ? iVec : this->index_[iEl];
+            this->value_[iEl] *= scale.col[iCol];
+          }
+        }
+      },
+      kMatrixPassGrainSize);
 }
 
 void HighsSparseMatrix::applyRowScale(const HighsScale& scale) {
   assert(this->formatOk());
-  if (this->isColwise()) {
-    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        this->value_[iEl] *= scale.row[this->index_[iEl]];
-    }
-  } else {
-    for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++)
-        this->value_[iEl] *= scale.row[iRow];
-    }
-  }
+  const bool colwise = this->isColwise();
+  const HighsInt num_vec = colwise ? this->num_col_ : this->num_row_;
+  highs::parallel::for_each_block(
+      0, num_vec,
+      [&](HighsInt from_vec, HighsInt to_vec) {
+        for (HighsInt iVec = from_vec; iVec < to_vec; iVec++) {
+          for (HighsInt iEl = this->start_[iVec]; iEl < this->start_[iVec + 1];
+               iEl++) {
+            const HighsInt iRow = colwise ? this->index_[iEl] : iVec;
+            this->value_[iEl] *= scale.row[iRow];
+          }
+        }
+      },
+      kMatrixPassGrainSize);
 }
 
 void HighsSparseMatrix::unapplyScale(const HighsScale& scale) {
   assert(this->formatOk());
-  if (this->isColwise()) {
-    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++) {
-        HighsInt iRow = this->index_[iEl];
-        this->value_[iEl] /= (scale.col[iCol] * scale.row[iRow]);
-      }
-    }
-  } else {
-    for (HighsInt iRow = 0; iRow < this->num_row_; iRow++) {
-      for (HighsInt iEl = this->start_[iRow]; iEl < this->start_[iRow + 1];
-           iEl++) {
-        HighsInt iCol = this->index_[iEl];
-        this->value_[iEl] /= (scale.col[iCol] * scale.row[iRow]);
-      }
-    }
-  }
+  const bool colwise = this->isColwise();
+  const HighsInt num_vec = colwise ? this->num_col_ : this->num_row_;
+  highs::parallel::for_each_block(
+      0, num_vec,
+      [&](HighsInt from_vec, HighsInt to_vec) {
+        for (HighsInt iVec = from_vec; iVec < to_vec; iVec++) {
+          for (HighsInt iEl = this->start_[iVec]; iEl < this->start_[iVec + 1];
+               iEl++) {
+            const HighsInt iCol = colwise ? iVec : this->index_[iEl];
+            const HighsInt iRow = colwise ? this->index_[iEl] : iVec;
+            this->value_[iEl] /= (scale.col[iCol] * scale.row[iRow]);
+          }
+        }
+      },
+      kMatrixPassGrainSize);
 }
 
 void HighsSparseMatrix::createSlice(const HighsSparseMatrix& matrix,
@@ -957,12 +964,13 @@ void HighsSparseMatrix::createRowwise(const HighsSparseMatrix& matrix) {
       ar_end[iRow]++;
     }
   }
-  // Compute the starts and turn the lengths into ends
-  ar_start[0] = 0;
-  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
-    ar_start[iRow + 1] = ar_start[iRow] + ar_end[iRow];
-    ar_end[iRow] = ar_start[iRow];
-  }
+  // Compute the starts as the exclusive prefix sums of the lengths,
+  // and turn the lengths into ends
+  std::copy(ar_end.begin(), ar_end.end(), ar_start.begin());
+  ar_start[num_row] = highs::parallel::scan(
+      ar_start.data(), num_row, HighsInt(0), std::plus<HighsInt>(),
+      kMatrixPassGrainSize);
+  std::copy(ar_start.begin(), ar_start.begin() + num_row, ar_end.begin());
   ar_index.resize(num_nz);
   ar_value.resize(num_nz);
   // Insert the entries
@@ -1198,22 +1206,22 @@ void HighsSparseMatrix::priceByColumn(const bool quad_precision,
   if (debug_report >= kDebugReportAll)
     printf("\nHighsSparseMatrix::priceByColumn:\n");
   result.count = 0;
-  for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-    double value = 0;
-    if (quad_precision) {
-      HighsCDouble quad_value = 0.0;
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        quad_value += column.array[this->index_[iEl]] * this->value_[iEl];
-      value = (double)quad_value;
-    } else {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        value += column.array[this->index_[iEl]] * this->value_[iEl];
-    }
-    if (fabs(value) > kHighsTiny) {
-      result.array[iCol] = value;
-      result.index[result.count++] = iCol;
+  // Form the products for blocks of columns, using SIMD kernels that
+  // accumulate each product in the same order as the scalar loop
+  const HighsInt block_size = 256;
+  double dot[block_size];
+  for (HighsInt from_col = 0; from_col < this->num_col_;
+       from_col += block_size) {
+    const HighsInt to_col = std::min(from_col + block_size, this->num_col_);
+    highsSimdColumnDot(from_col, to_col, this->start_.data(),
+                       this->index_.data(), this->value_.data(),
+                       column.array.data(), quad_precision, dot);
+    for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+      const double value = dot[iCol - from_col];
+      if (fabs(value) > kHighsTiny) {
+        result.array[iCol] = value;
+        result.index[result.count++] = iCol;
+      }
     }
   }
 }
@@ -1241,14 +1249,28 @@ void HighsSparseMatrix::priceByRowWithSwitch(
     const double expected_density, const HighsInt from_index,
     const double switch_density, const HighsInt debug_report) const {
   assert(this->isRowwise());
+  if (debug_report >= kDebugReportAll)
+    printf("\nHighsSparseMatrix::priceByRowWithSwitch\n");
+  if (!quad_precision) {
+    const HighsInt next_index = this->priceByRowSparseResultWithSwitch(
+        result, column, expected_density, from_index, switch_density,
+        debug_report);
+    if (next_index < column.count) {
+      // PRICE is not complete: finish without maintaining nonzeros of result
+      this->priceByRowDenseResult(result, column, next_index, debug_report);
+    } else {
+      // PRICE is complete maintaining nonzeros of result
+      // Remove small values
+      result.tight();
+    }
+    return;
+  }
   HighsSparseVectorSum sum;
   // todo @Julian: Setting up the sparse vector sum is equivalent to calling
   // HVector::setup() I think there should instead be overloads where the result
   // vector is of type HVectorQuad for the future and not the boolean parameter
   // quad_precision. Then the buffer can be maintained similar to row_ap.
-  if (quad_precision) sum.setDimension(num_col_);
-  if (debug_report >= kDebugReportAll)
-    printf("\nHighsSparseMatrix::priceByRowWithSwitch\n");
+  sum.setDimension(num_col_);
   // (Continue) hyper-sparse row-wise PRICE with possible switches to
   // standard row-wise PRICE either immediately based on historical
   // density or during hyper-sparse PRICE if there is too much fill-in
@@ -1279,73 +1301,104 @@ void HighsSparseMatrix::priceByRowWithSwitch(
       if (debug_report == kDebugReportAll || debug_report == iRow)
         debugReportRowPrice(iRow, multiplier, to_iEl, result.array);
       if (multiplier) {
-        if (quad_precision) {
-          for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
-            sum.add(this->index_[iEl], multiplier * this->value_[iEl]);
-          }
-        } else {
-          for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
-            HighsInt iCol = this->index_[iEl];
-            double value0 = result.array[iCol];
-            double value1 = value0 + multiplier * this->value_[iEl];
-            if (value0 == 0) result.index[result.count++] = iCol;
-            result.array[iCol] =
-                (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
-          }
+        for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
+          sum.add(this->index_[iEl], multiplier * this->value_[iEl]);
         }
       }
       next_index = ix + 1;
     }
   }
-  if (quad_precision)
-    sum.cleanup([](HighsInt, double x) { return std::abs(x) <= kHighsTiny; });
+  sum.cleanup([](HighsInt, double x) { return std::abs(x) <= kHighsTiny; });
   if (next_index < column.count) {
     // PRICE is not complete: finish without maintaining nonzeros of result
-    if (quad_precision) {
-      std::vector<HighsCDouble> result_array = sum.values;
-      this->priceByRowDenseResult(result_array, column, next_index);
-      // Determine indices of nonzeros in result
-      result.count = 0;
-      for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-        double value1 = (double)result_array[iCol];
-        if (fabs(value1) < kHighsTiny) {
-          result.array[iCol] = 0;
-        } else {
-          result.array[iCol] = value1;
-          result.index[result.count++] = iCol;
-        }
-      }
-    } else {
-      this->priceByRowDenseResult(result.array, column, next_index);
-      // Determine indices of nonzeros in result
-      result.count = 0;
-      for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-        double value1 = result.array[iCol];
-        if (fabs(value1) < kHighsTiny) {
-          result.array[iCol] = 0;
-        } else {
-          result.index[result.count++] = iCol;
-        }
+    std::vector<HighsCDouble> result_array = sum.values;
+    this->priceByRowDenseResult(result_array, column, next_index);
+    // Determine indices of nonzeros in result
+    result.count = 0;
+    for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
+      double value1 = (double)result_array[iCol];
+      if (fabs(value1) < kHighsTiny) {
+        result.array[iCol] = 0;
+      } else {
+        result.array[iCol] = value1;
+        result.index[result.count++] = iCol;
       }
     }
   } else {
-    if (quad_precision) {
-      // HVector result should have result.index of size this->num_col_
-      // by virtue of result.setup. However, it will generally lose
-      // this property by virtue of the following move
-      result.index = std::move(sum.nonzeroinds);
-      HighsInt result_num_nz = result.index.size();
-      // Restore the size of result.index
-      result.index.resize(this->num_col_);
-      result.count = result_num_nz;
-      for (HighsInt i = 0; i < result_num_nz; ++i) {
-        HighsInt iRow = result.index[i];
-        result.array[iRow] = sum.getValue(iRow);
+    // HVector result should have result.index of size this->num_col_
+    // by virtue of result.setup. However, it will generally lose
+    // this property by virtue of the following move
+    result.index = std::move(sum.nonzeroinds);
+    HighsInt result_num_nz = result.index.size();
+    // Restore the size of result.index
+    result.index.resize(this->num_col_);
+    result.count = result_num_nz;
+    for (HighsInt i = 0; i < result_num_nz; ++i) {
+      HighsInt iRow = result.index[i];
+      result.array[iRow] = sum.getValue(iRow);
+    }
+  }
+}
+
+HighsInt HighsSparseMatrix::priceByRowSparseResultWithSwitch(
+    HVector& result, const HVector& column, const double expected_density,
+    const HighsInt from_index, const double switch_density,
+    const HighsInt debug_report) const {
+  assert(this->isRowwise());
+  // (Continue) hyper-sparse row-wise PRICE, stopping when it should
+  // switch to standard row-wise PRICE either immediately based on
+  // historical density or because there is too much fill-in. Returns
+  // the index of column from which standard row-wise PRICE continues
+  HighsInt next_index = from_index;
+  // Ensure that result was set up for this number of columns, and
+  // that result.index is still of corect size
+  assert(HighsInt(result.size) == this->num_col_);
+  assert(HighsInt(result.index.size()) == this->num_col_);
+  if (expected_density > kHyperPriceDensity) return next_index;
+  for (HighsInt ix = next_index; ix < column.count; ix++) {
+    HighsInt iRow = column.index[ix];
+    // Determine whether p_end_ or the next start_ ends the loop
+    HighsInt to_iEl;
+    if (this->format_ == MatrixFormat::kRowwisePartitioned) {
+      to_iEl = this->p_end_[iRow];
+    } else {
+      to_iEl = this->start_[iRow + 1];
+    }
+    // Possibly switch to standard row-wise price
+    HighsInt row_num_nz = to_iEl - this->start_[iRow];
+    double local_density = (1.0 * result.count) / this->num_col_;
+    bool switch_to_dense = result.count + row_num_nz >= this->num_col_ ||
+                           local_density > switch_density;
+    if (switch_to_dense) break;
+    double multiplier = column.array[iRow];
+    if (debug_report == kDebugReportAll || debug_report == iRow)
+      debugReportRowPrice(iRow, multiplier, to_iEl, result.array);
+    if (multiplier) {
+      for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
+        HighsInt iCol = this->index_[iEl];
+        double value0 = result.array[iCol];
+        double value1 = value0 + multiplier * this->value_[iEl];
+        if (value0 == 0) result.index[result.count++] = iCol;
+        result.array[iCol] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
       }
+    }
+    next_index = ix + 1;
+  }
+  return next_index;
+}
+
+void HighsSparseMatrix::priceByRowDenseResult(
+    HVector& result, const HVector& column, const HighsInt from_index,
+    const HighsInt debug_report) const {
+  this->priceByRowDenseResult(result.array, column, from_index, debug_report);
+  // Determine indices of nonzeros in result
+  result.count = 0;
+  for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
+    double value1 = result.array[iCol];
+    if (fabs(value1) < kHighsTiny) {
+      result.array[iCol] = 0;
     } else {
-      // PRICE is complete maintaining nonzeros of result
-      // Remove small values
-      result.tight();
+      result.index[result.count++] = iCol;
     }
   }
 }
@@ -106,6 +106,16 @@ class HighsSparseMatrix {
       const double expected_density, const HighsInt from_index,
       const double switch_density,
       const HighsInt debug_report = kDebugReportOff) const;
+  // The two phases of priceByRowWithSwitch without quad precision, so
+  // that standard row-wise PRICE can be continued on slices of the
+  // matrix
+  HighsInt priceByRowSparseResultWithSwitch(
+      HVector& result, const HVector& column, const double expected_density,
+      const HighsInt from_index, const double switch_density,
+      const HighsInt debug_report = kDebugReportOff) const;
+  void priceByRowDenseResult(
+      HVector& result, const HVector& column, const HighsInt from_index,
+      const HighsInt debug_report = kDebugReportOff) const;
   void update(const HighsInt var_in, const HighsInt var_out,
               const HighsSparseMatrix& matrix);
   double computeDot(const HVector& column, const HighsInt use_col) const {